@@ -44,6 +44,13 @@ namespace GRINS
     virtual libMesh::Real operator()( const libMesh::Real T ) const =0;
 
     virtual libMesh::Real dT( const libMesh::Real T ) const =0;
+
+    //! Evaluate at each of T, storing the results in gamma
+    /*! One virtual call for all of the quadrature points on a side. The
+        default calls operator() at each point; subclasses override it
+        with a loop the compiler can inline and vectorize. */
+    virtual void evaluate( const std::vector<libMesh::Real>& T,
+                           std::vector<libMesh::Real>& gamma ) const;
     
     virtual void set_params( const std::vector<libMesh::Real>& params ) =0;
 
@@ -25,6 +25,9 @@
 #ifndef GRINS_CATALYTIC_WALL_BASE_H
 #define GRINS_CATALYTIC_WALL_BASE_H
 
+// C++
+#include <vector>
+
 // GRINS
 #include "grins/catalycity_base.h"
 #include "grins/neumann_bc_abstract.h"
@@ -77,6 +80,11 @@ namespace GRINS
     //! \f$ \rho_s \gamma \sqrt{ \frac{R_s T}{2\pi} } \f$
     libMesh::Real omega_dot( const libMesh::Real rho_s, const libMesh::Real T ) const;
 
+    //! omega_dot() at each of a set of points, e.g. the side quadrature points
+    void omega_dot( const std::vector<libMesh::Real>& rho_s,
+                    const std::vector<libMesh::Real>& T,
+                    std::vector<libMesh::Real>& omega ) const;
+
     libMesh::Real domega_dot_dws(  const libMesh::Real rho_s, const libMesh::Real w_s,
 				   const libMesh::Real T, const libMesh::Real R ) const;
 
@@ -92,6 +100,24 @@ namespace GRINS
     //! Temporary helper to deal with intermediate refactoring
     libMesh::Real eval_gamma_dT( libMesh::Real T ) const;
 
+    //! Catalycity at each of T, with one virtual call
+    void eval_gamma( const std::vector<libMesh::Real>& T,
+                     std::vector<libMesh::Real>& gamma ) const;
+
+    //! Reactant partial density and temperature at each side quadrature point
+    /*! Computed species by species over all of the quadrature points at
+        once, rather than point by point. */
+    void side_reactant_state( AssemblyContext& context,
+                              unsigned int reactant_species_idx,
+                              std::vector<libMesh::Real>& rho_r,
+                              std::vector<libMesh::Real>& T ) const;
+
+    //! Add scale times the value of var at each side quadrature point to values
+    void add_side_values( AssemblyContext& context,
+                          VariableIndex var,
+                          libMesh::Real scale,
+                          std::vector<libMesh::Real>& values ) const;
+
     SharedPtr<Chemistry> _chem_ptr;
 
     //! Deprecated
@@ -117,6 +143,9 @@ namespace GRINS
 
         \todo make const */
     libMesh::Real _p0;
+
+    //! Gas constant of each species, so \f$ R_{mix} = \sum_s R_s Y_s \f$
+    std::vector<libMesh::Real> _R_species;
   };
 
   /* ------------------------- Inline Functions -------------------------*/
@@ -166,6 +195,34 @@ namespace GRINS
     return rho_s*this->eval_gamma(T)*_C*std::sqrt(T);
   }
 
+  template<typename Chemistry>
+  inline
+  void CatalyticWallBase<Chemistry>::eval_gamma( const std::vector<libMesh::Real>& T,
+                                                 std::vector<libMesh::Real>& gamma ) const
+  {
+    if(_gamma_s)
+      _gamma_s->evaluate(T,gamma);
+    else if(_gamma_ptr)
+      _gamma_ptr->evaluate(T,gamma);
+    else
+      libmesh_error();
+  }
+
+  template<typename Chemistry>
+  inline
+  void CatalyticWallBase<Chemistry>::omega_dot( const std::vector<libMesh::Real>& rho_s,
+                                                const std::vector<libMesh::Real>& T,
+                                                std::vector<libMesh::Real>& omega ) const
+  {
+    libmesh_assert_equal_to( rho_s.size(), T.size() );
+
+    // Start from gamma and scale in place
+    this->eval_gamma( T, omega );
+
+    for( unsigned int i = 0; i != T.size(); i++ )
+      omega[i] *= rho_s[i]*_C*std::sqrt(T[i]);
+  }
+
   template<typename Chemistry>
   inline
   libMesh::Real CatalyticWallBase<Chemistry>::domega_dot_dws( const libMesh::Real rho_s, const libMesh::Real w_s,
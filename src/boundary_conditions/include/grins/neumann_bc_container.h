@@ -51,6 +51,9 @@ namespace GRINS
     bool has_bc_id( BoundaryID bc_id )
     { return (_bc_ids.find(bc_id) != _bc_ids.end()); }
 
+    const std::set<BoundaryID>& get_bc_ids() const
+    { return _bc_ids; }
+
     const FEVariablesBase& get_fe_var()
     { return _fe_var; }
 
@@ -41,6 +41,9 @@ namespace GRINS
     virtual libMesh::Real operator()( const libMesh::Real T ) const;
 
     virtual libMesh::Real dT( const libMesh::Real T ) const;
+
+    virtual void evaluate( const std::vector<libMesh::Real>& T,
+                           std::vector<libMesh::Real>& gamma ) const;
     
     virtual void set_params( const std::vector<libMesh::Real>& params );
 
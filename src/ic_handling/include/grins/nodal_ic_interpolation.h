@@ -0,0 +1,76 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_NODAL_IC_INTERPOLATION_H
+#define GRINS_NODAL_IC_INTERPOLATION_H
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/function_base.h"
+
+// libMesh forward declarations
+namespace libMesh
+{
+  class System;
+}
+
+namespace GRINS
+{
+  //! Set a System solution by interpolating a function at the mesh nodes
+  /*!
+    libMesh::System::project_solution() evaluates the function one
+    component at a time at the points of each element, so nodes shared
+    between elements, and the expressions of every variable, are evaluated
+    many times over. When all of the variables are LAGRANGE, every dof is a
+    nodal value, and the initial solution is just the function's values at
+    the nodes. Here, the whole function is evaluated once per local node,
+    with the nodes split between threads.
+
+    On second order elements, the values at edge and face nodes are
+    interpolated where project_solution() does a local projection, so the
+    two can differ there by the interpolation error of the function.
+   */
+  class NodalICInterpolation
+  {
+  public:
+
+    //! Is every variable of the system LAGRANGE, so that every dof is a nodal value?
+    static bool applies( const libMesh::System& system );
+
+    //! Set the solution to f at each local node, then update the ghosted solution
+    /*! f is evaluated as a vector-valued function whose components are the
+        system variables; components f does not set are zero, as with
+        project_solution(). Each thread evaluates its own clone of f.
+        Constraints are then enforced, as in project_solution(). It is an
+        error for f to return no values at a node, as a MeshFunction does
+        off its mesh without out-of-mesh mode. */
+    static void interpolate( libMesh::System& system,
+                             const libMesh::FunctionBase<libMesh::Number>& f,
+                             libMesh::Real time );
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_NODAL_IC_INTERPOLATION_H
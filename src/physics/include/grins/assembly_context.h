@@ -26,11 +26,25 @@
 #ifndef GRINS_ASSEMBLY_CONTEXT_H
 #define GRINS_ASSEMBLY_CONTEXT_H
 
+// C++
+#include <utility>
+#include <vector>
+
+// GRINS
+#include "grins/var_typedefs.h"
+#include "grins/shared_ptr.h"
+
 // libMesh
 #include "libmesh/fem_context.h"
+#include "libmesh/function_base.h"
+#include "libmesh/id_types.h"
+#include "libmesh/point.h"
 
 namespace GRINS
 {
+  // GRINS forward declarations
+  class MultiphysicsSystem;
+
   class AssemblyContext : public libMesh::FEMContext
   {
   public:
@@ -38,8 +52,73 @@ namespace GRINS
     AssemblyContext( const libMesh::System& system );
     ~AssemblyContext();
 
+    //! Skips the reinit on sides the side filter has nothing to assemble on
+    virtual void side_fe_reinit();
+
+    //! Whose MultiphysicsSystem::skip_side() to consult in side_fe_reinit()
+    /*! NULL, the default, means every side is reinitialized. */
+    void set_side_filter( const MultiphysicsSystem* system )
+    { _side_filter = system; }
+
+    //! Was the reinit for the current side skipped?
+    bool skip_side() const
+    { return _skip_side; }
+
+    //! Scratch space for the boundary ids of the current side
+    /*! Reused from side to side, so side assembly needn't allocate. */
+    std::vector<BoundaryID>& side_boundary_ids_scratch()
+    { return _side_boundary_ids; }
+
+    //! Values of a parsed property at the quadrature points of one element
+    /*! Kept by ParsedPropertyBase across assemblies. */
+    struct ParsedPropertyValues
+    {
+      ParsedPropertyValues();
+
+      std::vector<libMesh::Point> xyz;
+
+      libMesh::Real time;
+
+      std::vector<libMesh::Real> values;
+    };
+
+    //! A context's state for one parsed property
+    /*! A context is only used by one thread during one assembly, so this
+        needs no locking. */
+    struct ParsedPropertyState
+    {
+      ParsedPropertyState();
+
+      //! This context's copy of the property function
+      /*! The parser is not reentrant, so threads must not share it. */
+      SharedPtr<libMesh::FunctionBase<libMesh::Number> > func;
+
+      //! Does func depend on t?
+      bool time_dependent;
+
+      libMesh::dof_id_type elem_id;
+
+      //! First quadrature point, in case the element FE was reinitialized elsewhere
+      libMesh::Point xyz0;
+
+      //! The property's values on element elem_id, owned by the property
+      ParsedPropertyValues* elem_values;
+    };
+
+    //! This context's state for the given property, created empty on first use
+    ParsedPropertyState& parsed_property_state( const void* property );
+
   protected:
 
+    std::vector<BoundaryID> _side_boundary_ids;
+
+    const MultiphysicsSystem* _side_filter;
+
+    bool _skip_side;
+
+    //! There are only a few properties per context, so a linear search is fine
+    std::vector<std::pair<const void*,ParsedPropertyState> > _parsed_property_states;
+
   };
 
 } // end namespace GRINS
@@ -62,6 +62,9 @@ namespace GRINS
 
     ~AxisymmetricBoussinesqBuoyancy(){};
 
+    virtual bool has_side_terms( BoundaryID /*bc_id*/ ) const
+    { return false; }
+
     virtual void init_context( AssemblyContext& context );
 
     //! Source term contribution for AxisymmetricBoussinesqBuoyancy
@@ -53,6 +53,9 @@ namespace GRINS
 
     ~AxisymmetricHeatTransfer(){};
 
+    virtual bool has_side_terms( BoundaryID /*bc_id*/ ) const
+    { return false; }
+
     //! Sets velocity variables to be time-evolving
     virtual void set_time_evolving_vars( libMesh::FEMSystem* system );
 
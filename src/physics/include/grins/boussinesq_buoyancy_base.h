@@ -44,6 +44,9 @@ namespace GRINS
 
     ~BoussinesqBuoyancyBase(){};
 
+    virtual bool has_side_terms( BoundaryID /*bc_id*/ ) const
+    { return false; }
+
   protected:
 
     //! Helper function for parsing/maintaing backward compatibility
@@ -45,6 +45,9 @@ namespace GRINS
 
     virtual ~ConvectionDiffusion(){};
 
+    virtual bool has_side_terms( BoundaryID /*bc_id*/ ) const
+    { return false; }
+
     virtual void set_time_evolving_vars( libMesh::FEMSystem* system );
 
     //! Initialize context for added physics variables
@@ -41,6 +41,9 @@ namespace GRINS
     HeatConduction( const GRINS::PhysicsName& physics_name, const GetPot& input );
     ~HeatConduction(){};
 
+    virtual bool has_side_terms( BoundaryID /*bc_id*/ ) const
+    { return false; }
+
     virtual void set_time_evolving_vars( libMesh::FEMSystem* system );
 
     //! Initialize context for added physics variables
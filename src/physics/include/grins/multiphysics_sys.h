@@ -27,7 +27,11 @@
 #define GRINS_MULTIPHYSICS_SYS_H
 
 // C++
+#include <map>
+#include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 // GRINS
 #include "grins_config.h"
@@ -50,8 +54,11 @@ namespace libMesh
   class EquationSystems;
   class DiffContext;
 
+  template <typename T>
+  class ParameterAccessor;
   template <typename Scalar>
   class ParameterMultiAccessor;
+  class ParameterVector;
 }
 
 namespace GRINS
@@ -60,6 +67,8 @@ namespace GRINS
   template <typename Scalar>
   class PostProcessedQuantities;
 
+  class CompositeQoI;
+
   //! Interface with libMesh for solving Multiphysics problems.
   /*!
     MultiphysicsSystem (through libMesh::FEMSystem) solves the following equation:
@@ -109,6 +118,9 @@ namespace GRINS
     virtual void init_data();
     virtual void reinit_data();
 
+    //! Override System::reinit(), called after the mesh is refined, coarsened or repartitioned
+    virtual void reinit();
+
     //! Each Physics will register their postprocessed quantities with this call
     void register_postprocessing_vars( const GetPot& input,
                                        PostProcessedQuantities<libMesh::Real>& postprocessing );
@@ -131,6 +143,46 @@ namespace GRINS
                            bool get_jacobian,
                            bool apply_heterogeneous_constraints = false );
 
+    //! Override FEMSystem::assemble_qoi
+    /*! Only visits the elements and sides on which some QoI contributes,
+        as found by CompositeQoI::build_qoi_elems(). */
+    virtual void assemble_qoi( const libMesh::QoISet& qoi_indices = libMesh::QoISet() );
+
+    //! Override FEMSystem::assemble_qoi_derivative
+    /*! Only visits the elements and sides on which some QoI contributes,
+        as found by CompositeQoI::build_qoi_elems(). */
+    virtual void assemble_qoi_derivative( const libMesh::QoISet& qoi_indices = libMesh::QoISet(),
+                                          bool include_liftfunc = true,
+                                          bool apply_constraints = true );
+
+    //! Override DifferentiableSystem::adjoint_solve
+    /*! If Strategies/Adjoint/batched_solve is set and the time solver is
+        steady, the adjoint problems of all of the requested QoIs are
+        solved against one Jacobian, as libMesh does, but the
+        preconditioner is built only for the first QoI and reused for the
+        rest, and with Strategies/Adjoint/recycle_solutions each solve
+        starts from recycled_adjoint_guess(). Otherwise, defers to libMesh. */
+    virtual std::pair<unsigned int, libMesh::Real>
+    adjoint_solve( const libMesh::QoISet& qoi_indices = libMesh::QoISet() );
+
+    //! Override ImplicitSystem::sensitivity_solve
+    /*! If Strategies/Sensitivity/batched_solve is set, the residual
+        derivatives are assembled with our assemble_residual_derivatives()
+        and the preconditioner is built only for the first parameter.
+        Otherwise, defers to libMesh. */
+    virtual std::pair<unsigned int, libMesh::Real>
+    sensitivity_solve( const libMesh::ParameterVector& parameters );
+
+    //! Override ImplicitSystem::assemble_residual_derivatives
+    /*! If Strategies/Sensitivity/batched_solve is set, each parameter is
+        perturbed once in each direction and the residual is central
+        differenced in a threaded pass over the mesh, restricted to the
+        Physics that registered the parameter. Parameters that weren't
+        registered through register_parameter() are differenced with
+        whole assemblies, as libMesh does. Systems with SCALAR variables
+        are left to libMesh. */
+    virtual void assemble_residual_derivatives( const libMesh::ParameterVector& parameters );
+
     // residual and jacobian calculations
     // element_*, side_* as *time_derivative, *constraint, *mass_residual
 
@@ -183,12 +235,43 @@ namespace GRINS
                                                  const libMesh::Point& point,
                                                  libMesh::Real& value );
 
+    //! Neumann boundary conditions, built in init_data()
+    /*! Side assembly dispatches on a table built from these in
+        init_data(), so modifications made afterwards must be followed by
+        build_neumann_bc_dispatch(). */
     std::vector<SharedPtr<NeumannBCContainer> >& get_neumann_bcs()
     { return _neumann_bcs; }
 
     const std::vector<SharedPtr<NeumannBCContainer> >& get_neumann_bcs() const
     { return _neumann_bcs; }
 
+    //! Map each BoundaryID to the NeumannBCContainers active on it
+    void build_neumann_bc_dispatch();
+
+    //! Should residual assembly skip the current side of context?
+    /*! True while assembling if no Physics and no Neumann boundary
+        condition has terms on the side's boundary ids; see
+        Physics::has_side_terms(). */
+    bool skip_side( AssemblyContext& context ) const;
+
+    //! Toggle skipping sides with nothing to assemble; off by default
+    void set_skip_empty_sides( bool skip_sides )
+    { _skip_empty_sides = skip_sides; }
+
+    //! Toggle timing of element_time_derivative() on each element
+    /*! Used for cost-weighted load balancing. Times accumulate across
+        assemblies until reset_element_costs() is called. */
+    void set_measure_element_costs( bool measure_costs )
+    { _measure_element_costs = measure_costs; }
+
+    //! Accumulated element_time_derivative() wall time, indexed by Elem::id()
+    /*! Only entries for local elements are nonzero. */
+    const std::vector<libMesh::Real>& element_costs() const
+    { return _element_costs; }
+
+    void reset_element_costs()
+    { _element_costs.clear(); }
+
 #ifdef GRINS_USE_GRVY_TIMERS
     //! Add GRVY Timer object to system for timing physics.
     void attach_grvy_timer( GRVY::GRVY_Timer_Class* grvy_timer );
@@ -210,6 +293,48 @@ namespace GRINS
     // A list of values for per-variable numerical jacobian deltas
     std::vector<libMesh::Real> _numerical_jacobian_h_values;
 
+    bool _measure_element_costs;
+
+    //! Element assembly times, indexed by Elem::id()
+    /*! Sized in assembly(), before threads are spawned, so that each
+        thread only writes the entries of the elements it assembles. */
+    std::vector<libMesh::Real> _element_costs;
+
+    //! Solve all of the steady adjoint problems with one preconditioner
+    bool _batched_adjoint_solve;
+
+    //! Start each batched adjoint solve from the span of the previous solutions
+    bool _recycle_adjoint_solutions;
+
+    //! Assemble all of the residual derivatives in one pass, sharing one preconditioner
+    bool _batched_sensitivity_solve;
+
+    //! Skip residual assembly on sides nothing contributes to
+    bool _skip_empty_sides;
+
+    //! Set the initial conditions by NodalICInterpolation where possible
+    bool _nodal_ic_interpolation;
+
+    //! Are we in an assembly where skip_side() applies?
+    bool _filter_sides;
+
+    //! The Physics that registered each parameter, by the accessor passed to register_parameter()
+    std::map<const libMesh::ParameterAccessor<libMesh::Number>*, std::set<std::string> > _parameter_physics;
+
+    //! If not NULL, _general_residual() only assembles the residuals of these Physics
+    /*! The caches of all of the Physics are still computed, since they
+        are shared. */
+    const std::set<std::string>* _residual_physics;
+
+    //! Incremented whenever the system is (re)initialized, i.e. whenever the mesh may have changed
+    /*! CompositeQoI::build_qoi_elems() uses this to only rebuild its element lists on a mesh change. */
+    unsigned int _mesh_version;
+
+    //! Boundary ids of sides with terms to assemble
+    /*! Includes libMesh::BoundaryInfo::invalid_id if sides with no
+        boundary id have terms. */
+    std::set<BoundaryID> _side_term_ids;
+
     //! Cached for helping build boundary conditions
     /*! We can't make a copy because it will muck up the UFO detection
         amongst other things. So, we keep a raw pointer. We don't own this
@@ -223,6 +348,11 @@ namespace GRINS
         libMesh::UniquePtr may still actually be an AutoPtr. */
     std::vector<SharedPtr<NeumannBCContainer> > _neumann_bcs;
 
+    //! The _neumann_bcs active on each BoundaryID, in _neumann_bcs order
+    /*! Raw pointers, owned by _neumann_bcs, so that threaded side assembly
+        doesn't touch the shared reference counts. */
+    std::map<BoundaryID, std::vector<NeumannBCContainer*> > _neumann_bc_dispatch;
+
 #ifdef GRINS_USE_GRVY_TIMERS
     GRVY::GRVY_Timer_Class* _timer;
 #endif
@@ -237,14 +367,48 @@ namespace GRINS
                             ResFuncType resfunc,
                             CacheFuncType cachefunc);
 
-    //! Extract the bcs from neumann_bcs that are active on bc_id and return them in active_neumann_bcs
-    void get_active_neumann_bcs( BoundaryID bc_id,
-                                 const std::vector<SharedPtr<NeumannBCContainer> >& neumann_bcs,
-                                 std::vector<SharedPtr<NeumannBCContainer> >& active_neumann_bcs );
+    //! Find the boundary ids of sides with terms to assemble
+    void build_side_term_ids();
+
+    //! Set the solution to the Physics initial conditions
+    /*! Uses NodalICInterpolation if requested and all of the variables
+        are LAGRANGE, otherwise project_solution(). */
+    void project_initial_conditions( libMesh::FunctionBase<libMesh::Number>& ics );
 
     //! Applies the subset of _neumann_bcs that are active on the current element side
     bool apply_neumann_bcs( bool request_jacobian,
                             libMesh::DiffContext& context );
+
+    //! The CompositeQoI, if QoI assembly can be restricted to its qoi_elems()
+    /*! Returns NULL if there is no CompositeQoI, or if any of the requested
+        QoIs has adjoint Dirichlet boundaries, e.g. WeightedFluxQoI. Those are
+        evaluated by FEMSystem from the residual on every element. */
+    CompositeQoI* restricted_qoi( const libMesh::QoISet& qoi_indices );
+
+    //! Central difference of the full residual with respect to parameter p, into its sensitivity rhs
+    void assemble_residual_derivative( libMesh::ParameterVector& parameters,
+                                       unsigned int p );
+
+    //! Initial guess for the adjoint solution of QoI q from previously solved QoIs
+    /*! Adds to the adjoint solution y the combination of solution_basis
+        (\f$A^T s_j = r_j\f$, with orthonormal \f$r_j\f$ in rhs_basis)
+        that removes the components of the residual \f$q - A^T y\f$
+        along rhs_basis. Starting from zero, this is the projection of
+        the adjoint rhs onto rhs_basis; starting from an adjoint projected
+        from the previous mesh, it corrects that solution. Only products
+        with \f$A\f$ are needed, since \f$r_j \cdot A^T y = A r_j \cdot y\f$.
+        Returns false, leaving the adjoint solution untouched, if there
+        is nothing to correct. */
+    bool recycled_adjoint_guess
+      ( unsigned int q,
+        const std::vector<SharedPtr<libMesh::NumericVector<libMesh::Number> > >& rhs_basis,
+        const std::vector<SharedPtr<libMesh::NumericVector<libMesh::Number> > >& solution_basis );
+
+    //! Orthonormalize the rhs of the solved QoI q against rhs_basis and add it
+    void extend_adjoint_basis
+      ( unsigned int q,
+        std::vector<SharedPtr<libMesh::NumericVector<libMesh::Number> > >& rhs_basis,
+        std::vector<SharedPtr<libMesh::NumericVector<libMesh::Number> > >& solution_basis );
   };
 
   inline
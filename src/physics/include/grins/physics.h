@@ -121,6 +121,19 @@ namespace GRINS
     //! Find if current physics is active on supplied element
     virtual bool enabled_on_elem( const libMesh::Elem* elem );
 
+    //! Does this physics have side terms on sides with boundary id bc_id?
+    /*!
+      With Strategies/Assembly/skip_empty_sides, MultiphysicsSystem skips
+      residual assembly, including the side FE reinit, on sides where no
+      Physics and no Neumann boundary condition contributes. bc_id is
+      libMesh::BoundaryInfo::invalid_id for sides with no boundary id.
+      The default is true. Several in-tree Physics bases return false, so
+      a Physics derived from one of them that adds side terms must
+      override this again, or leave skip_empty_sides off.
+     */
+    virtual bool has_side_terms( BoundaryID /*bc_id*/ ) const
+    { return true; }
+
     //! Sets whether this physics is to be solved with a steady solver or not
     /*! Since the member variable is static, only needs to be called on a single
       physics. */
@@ -56,6 +56,9 @@ namespace GRINS
 
     ~ScalarODE(){};
 
+    virtual bool has_side_terms( BoundaryID /*bc_id*/ ) const
+    { return false; }
+
     //! Sets scalar variable(s) to be time-evolving
     virtual void set_time_evolving_vars( libMesh::FEMSystem* system );
 
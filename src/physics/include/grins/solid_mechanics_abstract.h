@@ -43,6 +43,9 @@ namespace GRINS
 
     virtual ~SolidMechanicsAbstract(){};
 
+    virtual bool has_side_terms( BoundaryID /*bc_id*/ ) const
+    { return false; }
+
     virtual void set_time_evolving_vars( libMesh::FEMSystem* system );
 
   protected:
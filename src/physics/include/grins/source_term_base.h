@@ -55,6 +55,9 @@ namespace GRINS
 
     virtual ~SourceTermBase();
 
+    virtual bool has_side_terms( BoundaryID /*bc_id*/ ) const
+    { return false; }
+
     virtual void init_variables( libMesh::FEMSystem* system );
 
   protected:
@@ -53,6 +53,9 @@ namespace GRINS
 
     ~TurbulenceModelsBase(){};
 
+    virtual bool has_side_terms( BoundaryID /*bc_id*/ ) const
+    { return false; }
+
     // Registers all parameters in this physics and in its property
     // classes
     virtual void register_parameter
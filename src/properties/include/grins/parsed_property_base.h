@@ -36,19 +36,36 @@
 #include "libmesh/point.h"
 
 // C++
+#include <map>
 #include <string>
+#include <vector>
+
+// libMesh forward declarations
+namespace libMesh
+{
+  class MeshBase;
+}
 
 namespace GRINS
 {
   //! Base class for material properties based on ParsedFunction
   /*! This class contains the basic interface and functionality. Subclasses
       should only need to handle the parsing of the function-string and
-      create the ParsedFunction in the local _func variable. */
+      create the ParsedFunction in the local _func variable.
+
+      The values at each element's quadrature points are cached across
+      assemblies, so for time-independent expressions the parser only
+      runs again when the mesh or the expression changes, e.g. when a
+      parameter perturbation rewrites one of its inline variables.
+      Expressions that depend on t are recomputed when the time changes.
+      Each AssemblyContext, i.e. each thread, evaluates its own copy of
+      the function; an element's values are only touched by the thread
+      assembling it, so only the lookup is locked. */
   class ParsedPropertyBase
   {
   public:
 
-    ParsedPropertyBase() : _func("") {};
+    ParsedPropertyBase();
     virtual ~ParsedPropertyBase(){};
 
     libMesh::Real operator()(AssemblyContext& context, unsigned int qp) const;
@@ -68,26 +85,28 @@ namespace GRINS
     // User specified parsed function
     libMesh::ParsedFunction<libMesh::Number> _func;
 
-  };
+  private:
 
-  /* ------------------------- Inline Functions -------------------------*/
-  inline
-  libMesh::Real ParsedPropertyBase::operator()(AssemblyContext& context, unsigned int qp) const
-  {
-    // FIXME: We should be getting the variable index to get the qps from the context
-    // not hardcode it to be 0
-    const std::vector<libMesh::Point>& x = context.get_element_fe(0)->get_xyz();
+    //! Clear the cached values if the mesh or the expression changed
+    void check_cached_values( const AssemblyContext& context ) const;
 
-    const libMesh::Point& x_qp = x[qp];
+    void compute_values( libMesh::FunctionBase<libMesh::Number>& func,
+                         const std::vector<libMesh::Point>& x,
+                         libMesh::Real time,
+                         AssemblyContext::ParsedPropertyValues& cache ) const;
 
-    // libMesh API here sucks - RHS
-    libMesh::ParsedFunction<libMesh::Number> & mutable_func =
-      const_cast<libMesh::ParsedFunction<libMesh::Number> &>(_func);
-    libMesh::Number value = mutable_func(x_qp,context.time);
+    //! Values at the quadrature points last used on each element
+    mutable std::map<libMesh::dof_id_type, AssemblyContext::ParsedPropertyValues> _cached_values;
 
-    return value;
-  }
+    //! What _cached_values were computed for
+    mutable const libMesh::MeshBase* _cached_mesh;
+    mutable libMesh::dof_id_type _cached_n_elem;
+    mutable libMesh::dof_id_type _cached_max_elem_id;
+    mutable std::string _cached_expression;
 
+  };
+
+  /* ------------------------- Inline Functions -------------------------*/
   inline
   libMesh::Real ParsedPropertyBase::operator()( const libMesh::Point& p, const libMesh::Real time )
   {
@@ -68,9 +68,6 @@ namespace GRINS
     //! Temperature variable index
     VariableIndex _T_var;
 
-    //! List of boundary ids for which we want to compute this QoI
-    std::set<libMesh::boundary_id_type> _bc_ids;
-
     //! Scaling constant
     libMesh::Real _scaling;
 
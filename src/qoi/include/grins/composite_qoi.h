@@ -38,6 +38,8 @@ class GetPot;
 namespace libMesh
 {
   class DiffContext;
+  class Elem;
+  class MeshBase;
   class QoISet;
   namespace Parallel
   {
@@ -82,6 +84,31 @@ namespace GRINS
      */
     virtual void init( const GetPot& input, const MultiphysicsSystem& system );
 
+    //! Calls each QoI's reinit function after the mesh has been refined and/or coarsened.
+    void reinit( MultiphysicsSystem& system );
+
+    //! Find the active local elements and boundary sides on which some QoI contributes
+    /*!
+     * Uses each QoI's interior_support() and side_support(). MultiphysicsSystem
+     * assembles the QoIs and their derivatives over only these elements, and
+     * calls this at the start of each such assembly with a counter that it
+     * increments whenever the system is reinitialized. The lists hold raw Elem
+     * pointers, so they are rebuilt whenever mesh_version differs from the
+     * one they were built for: the mesh may have changed without a reinit()
+     * of the QoIs, e.g. on restart or inside libMesh's AdjointRefinementEstimator.
+     * Clones do not copy the lists.
+     */
+    void build_qoi_elems( const libMesh::MeshBase& mesh, unsigned int mesh_version );
+
+    //! Active local elements on which some QoI contributes on the interior or a side
+    const std::vector<const libMesh::Elem*>& qoi_elems() const;
+
+    //! Does some QoI contribute on the interior of qoi_elems()[e]?
+    bool qoi_on_interior( unsigned int e ) const;
+
+    //! Boundary sides of qoi_elems()[e] on which some QoI contributes
+    const std::vector<unsigned short>& qoi_sides( unsigned int e ) const;
+
     /*!
      * Method to allow QoI to resize libMesh::System storage of QoI computations.
      */
@@ -129,11 +156,48 @@ namespace GRINS
     const QoIBase& get_qoi( unsigned int qoi_index ) const;
 
   protected:
+
+    //! Does qoi contribute on a side with the given boundary ids?
+    bool on_side_support( const QoIBase& qoi,
+                          const std::vector<libMesh::boundary_id_type>& side_ids ) const;
     
     std::vector<QoIBase*> _qois;
 
+    //! Elements found by build_qoi_elems()
+    std::vector<const libMesh::Elem*> _qoi_elems;
+
+    //! Whether some QoI contributes on each of _qoi_elems interiors
+    std::vector<bool> _qoi_on_interior;
+
+    //! The sides of each of _qoi_elems on which some QoI contributes
+    std::vector<std::vector<unsigned short> > _qoi_sides;
+
+    //! The mesh_version passed to build_qoi_elems() when the lists were built
+    /*! libMesh::invalid_uint if the lists need to be rebuilt. */
+    unsigned int _qoi_elems_mesh_version;
+
   };
 
+  inline
+  const std::vector<const libMesh::Elem*>& CompositeQoI::qoi_elems() const
+  {
+    return _qoi_elems;
+  }
+
+  inline
+  bool CompositeQoI::qoi_on_interior( unsigned int e ) const
+  {
+    libmesh_assert_less( e, _qoi_on_interior.size() );
+    return _qoi_on_interior[e];
+  }
+
+  inline
+  const std::vector<unsigned short>& CompositeQoI::qoi_sides( unsigned int e ) const
+  {
+    libmesh_assert_less( e, _qoi_sides.size() );
+    return _qoi_sides[e];
+  }
+
   inline
   unsigned int CompositeQoI::n_qois() const
   {
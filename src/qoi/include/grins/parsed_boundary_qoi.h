@@ -29,6 +29,7 @@
 // GRINS
 #include "grins/qoi_base.h"
 #include "grins/variable_name_defaults.h"
+#include "grins/parsed_qoi_derivative.h"
 
 // libMesh
 #include "libmesh/fem_function_base.h"
@@ -78,9 +79,12 @@ namespace GRINS
     libMesh::UniquePtr<libMesh::FEMFunctionBase<libMesh::Number> >
       qoi_functional;
 
+    //! Symbolic derivative of qoi_functional
+    ParsedQoIDerivative _qoi_derivative;
 
-    //! List of boundary ids on which we want to compute this QoI
-    std::set<libMesh::boundary_id_type> _bc_ids;
+    //! False if qoi_functional could not be differentiated symbolically,
+    //! in which case we finite difference it instead.
+    bool _analytic_derivative;
 
     //! Manual copy constructor due to the UniquePtr
     ParsedBoundaryQoI(const ParsedBoundaryQoI& original);
@@ -29,6 +29,7 @@
 // GRINS
 #include "grins/qoi_base.h"
 #include "grins/variable_name_defaults.h"
+#include "grins/parsed_qoi_derivative.h"
 
 // libMesh
 #include "libmesh/fem_function_base.h"
@@ -78,6 +79,13 @@ namespace GRINS
     libMesh::UniquePtr<libMesh::FEMFunctionBase<libMesh::Number> >
       qoi_functional;
 
+    //! Symbolic derivative of qoi_functional
+    ParsedQoIDerivative _qoi_derivative;
+
+    //! False if qoi_functional could not be differentiated symbolically,
+    //! in which case we finite difference it instead.
+    bool _analytic_derivative;
+
     //! Manual copy constructor due to the UniquePtr
     ParsedInteriorQoI(const ParsedInteriorQoI& original);
 
@@ -0,0 +1,155 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_PARSED_QOI_DERIVATIVE_H
+#define GRINS_PARSED_QOI_DERIVATIVE_H
+
+// C++
+#include <string>
+#include <vector>
+
+// GRINS
+#include "grins/var_typedefs.h"
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/fparser_ad.hh"
+#include "libmesh/parsed_fem_function.h"
+
+namespace GRINS
+{
+  // GRINS forward declarations
+  class MultiphysicsSystem;
+  class AssemblyContext;
+
+  //! Analytic derivative of a parsed QoI functional
+  /*!
+    Takes a QoI functional written in the ParsedFEMFunction syntax, i.e.
+    a function of x, y, z, t, the names of solution variables, their
+    gradient components grad_x_<var>, grad_y_<var>, grad_z_<var> and, on
+    sides, the normal components n_x, n_y, n_z, and differentiates it
+    symbolically with FParserAD with respect to each of the solution
+    values and gradient components that appear in it.
+
+    The derivatives are evaluated once per quadrature point and
+    contracted with the shape functions (and their gradients) to give the
+    QoI derivative with respect to the element dofs. This replaces finite
+    differencing the functional with respect to each dof.
+
+    Leading inline variable statements with constant values, e.g. the
+    "a:=1;" of "a:=1;a*u", become extra arguments of the derivatives.
+    Those variables may be registered parameters, e.g. stepped by a
+    parameter continuation, so their values are read from the QoI's
+    ParsedFEMFunction in init_context(), at the start of each assembly.
+   */
+  class ParsedQoIDerivative
+  {
+  public:
+
+    ParsedQoIDerivative();
+
+    //! Deep copies the parsers, so that copies can be evaluated on different threads
+    ParsedQoIDerivative( const ParsedQoIDerivative& original );
+
+    ~ParsedQoIDerivative(){};
+
+    //! Differentiate the given functional
+    /*!
+      @return false if fparser could not differentiate the functional,
+      e.g. if it depends on Hessians of the solution, in which case the
+      caller should fall back on finite differencing.
+     */
+    bool init( const std::string& expression,
+               const MultiphysicsSystem& system,
+               bool on_sides );
+
+    //! Compile the derivatives to native code; see FParserJIT::compile()
+    /*! Returns the number of derivatives that were compiled. Any others
+        stay interpreted. */
+    unsigned int jit_compile();
+
+    //! Request the FE data needed by add_derivative()
+    /*! Also takes the current values of the inline variables from
+        functional, which must be the QoI's parsed functional. */
+    void init_context( AssemblyContext& context,
+                       const libMesh::ParsedFEMFunction<libMesh::Number>& functional );
+
+    //! Add the derivative of the integral of the functional over the current element interior (or side)
+    void add_derivative( AssemblyContext& context, const unsigned int qoi_index );
+
+  private:
+
+    //! Position of the name in the expression, as a whole word, or npos.
+    static std::size_t find_name( const std::string& name,
+                                  const std::string& expression );
+
+    //! Derivative of the functional with respect to one variable value or gradient component
+    struct Term
+    {
+      Term( VariableIndex var_in, int component_in,
+            const libMesh::FunctionParserADBase<libMesh::Number>& f )
+        : var(var_in), component(component_in), df(f)
+      {}
+
+      VariableIndex var;
+
+      //! -1 for the value, otherwise the gradient component
+      int component;
+
+      libMesh::FunctionParserADBase<libMesh::Number> df;
+    };
+
+    //! Do we integrate over sides?
+    bool _on_sides;
+
+    //! Variables whose values or gradients are arguments of the functional
+    std::vector<VariableIndex> _vars;
+
+    //! Index in the argument list of each of _vars values, or -1 if not needed
+    std::vector<int> _value_arg;
+
+    //! Index in the argument list of each of _vars gradient components, or -1 if not needed
+    std::vector<std::vector<int> > _grad_arg;
+
+    //! Index in the argument list of the first normal component, or -1 if not needed
+    int _normal_arg;
+
+    //! Leading inline variables of the functional
+    std::vector<std::string> _inline_names;
+
+    //! Index in the argument list of the first inline variable
+    unsigned int _inline_arg;
+
+    //! Number of arguments of the functional
+    unsigned int _n_args;
+
+    std::vector<Term> _terms;
+
+    //! Scratch space for the arguments at a quadrature point
+    std::vector<libMesh::Number> _args;
+  };
+
+}
+#endif //GRINS_PARSED_QOI_DERIVATIVE_H
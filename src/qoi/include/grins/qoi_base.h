@@ -28,6 +28,7 @@
 
 // C++
 #include <iomanip>
+#include <set>
 
 // libMesh
 #include "libmesh/diff_qoi.h"
@@ -39,6 +40,11 @@
 // libMesh forward declarations
 class GetPot;
 
+namespace libMesh
+{
+  class Elem;
+}
+
 namespace GRINS
 {
   // Forward declarations
@@ -68,6 +74,21 @@ namespace GRINS
     /*! This is pure virtual to force to user to specify. */
     virtual bool assemble_on_sides() const =0;
 
+    //! Does the QoI contribute on the interior of elem?
+    /*!
+     * Only called if assemble_on_interior(). By default, this is true for elements
+     * in _subdomain_ids, or for every element if _subdomain_ids is empty. CompositeQoI
+     * uses this to skip elements on which no QoI contributes. Override this for
+     * QoIs with finer grained support.
+     */
+    virtual bool interior_support( const libMesh::Elem& elem ) const;
+
+    //! Boundary ids of the sides on which the QoI contributes
+    /*!
+     * Only used if assemble_on_sides(). Empty means all boundary sides.
+     */
+    const std::set<BoundaryID>& side_support() const;
+
     /*!
      * Method to allow QoI to cache any system information needed for QoI calculation,
      * for example, solution variable indices.
@@ -76,6 +97,9 @@ namespace GRINS
                        const MultiphysicsSystem& system,
                        unsigned int qoi_num );
 
+    //! Update any cached mesh information after the mesh has been refined and/or coarsened.
+    virtual void reinit( MultiphysicsSystem& system );
+
     virtual void init_context( AssemblyContext& context );
 
     //! Compute the qoi value for element interiors.
@@ -127,8 +151,20 @@ namespace GRINS
     std::string _qoi_name;
 
     libMesh::Number _qoi_value;
+
+    //! Subdomain ids on which the QoI contributes. Empty means all subdomains.
+    std::set<libMesh::subdomain_id_type> _subdomain_ids;
+
+    //! Boundary ids on which the QoI contributes. Empty means all boundary sides.
+    std::set<BoundaryID> _bc_ids;
   };
 
+  inline
+  const std::set<BoundaryID>& QoIBase::side_support() const
+  {
+    return _bc_ids;
+  }
+
   inline
   libMesh::Number QoIBase::value() const
   {
@@ -0,0 +1,117 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_RAYFIRE_BUNDLE_H
+#define GRINS_RAYFIRE_BUNDLE_H
+
+// C++
+#include <map>
+#include <vector>
+
+// GRINS
+#include "grins/shared_ptr.h"
+#include "grins/rayfire_mesh.h"
+
+// libMesh
+#include "libmesh/point.h"
+
+namespace GRINS
+{
+  //! RayfireBundle
+  /*!
+  A collection of RayfireMesh objects, e.g. for the many lines of sight
+  of a spectroscopic measurement. A single point locator is used to find
+  the starting elements of all the rays, and the rays are then walked
+  across the mesh in parallel, threaded over the rays.
+
+  The bundle also indexes the rays by main mesh element, so that an
+  integration class looping over the main mesh can find all of the rays
+  passing through an element with a single lookup.
+
+  Each ray still keeps its own 1D mesh; the rays are not yet stored in a
+  single compact mesh. 3D rays can be added, but init() will fail until
+  RayfireMesh supports 3D rayfires.
+  */
+  class RayfireBundle
+  {
+  public:
+
+    RayfireBundle(){};
+
+    //! Add a 2D ray. Must be called before init().
+    /*!
+    @param origin Origin point (x,y) of the rayfire on mesh boundary
+    @param theta Spherical polar angle (in radians)
+    */
+    void add_ray(const libMesh::Point& origin, libMesh::Real theta);
+
+    //! Add a 3D ray. Must be called before init().
+    /*!
+    @param origin Origin point (x,y,z) of the rayfire on mesh boundary
+    @param theta  Spherical polar angle (in radians)
+    @param phi    Spherical azimuthal angle (in radians)
+    */
+    void add_ray(const libMesh::Point& origin, libMesh::Real theta, libMesh::Real phi);
+
+    //! Perform the rayfire for all rays
+    void init(const libMesh::MeshBase& mesh_base);
+
+    //! Update all rays after the main mesh was refined and/or coarsened
+    void reinit(const libMesh::MeshBase& mesh_base);
+
+    unsigned int n_rays() const
+    { return _rays.size(); }
+
+    const RayfireMesh& ray(unsigned int r) const
+    { return *(_rays[r]); }
+
+    //! Rays passing through the given main mesh element
+    /*!
+    @param elem_id The ID of the elem on the main mesh
+    @return (ray index, 1D rayfire elem) pairs for each ray through the elem.
+            Empty if no rays pass through the elem.
+    */
+    const std::vector<std::pair<unsigned int,const libMesh::Elem*> >&
+    map_to_rayfire_elems(const libMesh::dof_id_type elem_id) const;
+
+  private:
+
+    //! RayfireMesh keeps a reference to its origin, so we own them here
+    std::vector<SharedPtr<libMesh::Point> > _origins;
+
+    std::vector<SharedPtr<RayfireMesh> > _rays;
+
+    //! Main mesh elem_id to the rays through that elem
+    std::map<libMesh::dof_id_type,std::vector<std::pair<unsigned int,const libMesh::Elem*> > > _elem_rays;
+
+    //! Returned for elems no ray passes through
+    std::vector<std::pair<unsigned int,const libMesh::Elem*> > _no_rays;
+
+    //! Rebuild _elem_rays from the individual rays
+    void build_elem_index();
+  };
+
+}
+#endif //GRINS_RAYFIRE_BUNDLE_H
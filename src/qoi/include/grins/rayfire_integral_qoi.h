@@ -0,0 +1,143 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_RAYFIRE_INTEGRAL_QOI_H
+#define GRINS_RAYFIRE_INTEGRAL_QOI_H
+
+// C++
+#include <string>
+#include <vector>
+
+// GRINS
+#include "grins/qoi_base.h"
+#include "grins/shared_ptr.h"
+#include "grins/var_typedefs.h"
+#include "grins/rayfire_mesh.h"
+
+// libMesh
+#include "libmesh/fparser_ad.hh"
+
+namespace GRINS
+{
+  //! Rayfire Integral QoI
+  /*!
+    This class implements a QoI that is the integral of a parsed function
+    of the solution along a line of sight through the domain, e.g. the
+    absorbance measured by a laser diagnostic. The line is found with a
+    RayfireMesh, and the integral is computed with quadrature on its 1D
+    elements, so only the main mesh elements the ray passes through
+    contribute.
+
+    The functional may depend on x, y, z, t and the solution variables
+    listed in QoI/RayfireIntegral/variables. Its derivatives with respect
+    to those variables are computed symbolically with FParserAD, so the
+    QoI derivative needed for adjoint solves is exact.
+   */
+  class RayfireIntegralQoI : public QoIBase
+  {
+  public:
+
+    //! Constructor
+    /*! Constructor takes GetPot object to read any input options associated
+        with this QoI */
+    RayfireIntegralQoI( const std::string& qoi_name );
+
+    virtual ~RayfireIntegralQoI();
+
+    //! Required to provide clone (deep-copy) for adding QoI object to libMesh objects.
+    /*! The RayfireMesh is shared between clones. */
+    virtual QoIBase* clone() const;
+
+    virtual bool assemble_on_interior() const;
+
+    virtual bool assemble_on_sides() const;
+
+    //! Initialize local variables and perform the rayfire
+    virtual void init( const GetPot& input,
+                       const MultiphysicsSystem& system,
+                       unsigned int qoi_num );
+
+    //! Update the rayfire after the mesh has been refined and/or coarsened
+    virtual void reinit( MultiphysicsSystem& system );
+
+    //! Only the elements the ray passes through contribute
+    virtual bool interior_support( const libMesh::Elem& elem ) const;
+
+    //! Compute the qoi value.
+    virtual void element_qoi( AssemblyContext& context,
+                              const unsigned int qoi_index );
+
+    //! Compute the qoi derivative with respect to the solution.
+    virtual void element_qoi_derivative( AssemblyContext& context,
+                                         const unsigned int qoi_index );
+
+  protected:
+
+    //! Quadrature points along the rayfire elem
+    /*!
+      Computes the physical quadrature points and weights on rayfire_elem,
+      the quadrature points in the reference coordinates of the main mesh
+      elem of the context, and the values of the functional's variables
+      at each quadrature point.
+     */
+    void ray_qp_values( AssemblyContext& context,
+                        const libMesh::Elem& rayfire_elem,
+                        std::vector<libMesh::Real>& JxW,
+                        std::vector<libMesh::Point>& ref_qp,
+                        std::vector<std::vector<libMesh::Number> >& qp_values ) const;
+
+    //! Owned here since RayfireMesh keeps a reference to its origin
+    SharedPtr<libMesh::Point> _origin;
+
+    SharedPtr<RayfireMesh> _rayfire;
+
+    //! Solution variables the functional depends on
+    std::vector<VariableIndex> _vars;
+
+    //! f(x,y,z,t,u_0,...,u_n)
+    libMesh::FunctionParserADBase<libMesh::Number> _functional;
+
+    //! Derivatives of _functional with respect to each of _vars
+    std::vector<libMesh::FunctionParserADBase<libMesh::Number> > _derivatives;
+
+  private:
+    //! User never call default constructor.
+    RayfireIntegralQoI();
+
+  };
+
+  inline
+  bool RayfireIntegralQoI::assemble_on_interior() const
+  {
+    return true;
+  }
+
+  inline
+  bool RayfireIntegralQoI::assemble_on_sides() const
+  {
+    return false;
+  }
+}
+#endif //GRINS_RAYFIRE_INTEGRAL_QOI_H
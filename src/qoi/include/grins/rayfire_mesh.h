@@ -26,6 +26,9 @@
 #ifndef GRINS_RAYFIRE_MESH_H
 #define GRINS_RAYFIRE_MESH_H
 
+// C++
+#include <limits>
+
 // libMesh
 #include "libmesh/quadrature.h"
 #include "libmesh/mesh.h"
@@ -60,8 +63,7 @@ namespace GRINS
   integration directly along the line, rather than using the entire 2D/3D elements
   of the main mesh.
   
-  Refinement of the rayfire mesh is supported through the reinit() function.
-  Coarsening is not yet supported.
+  Refinement and coarsening of the main mesh are supported through the reinit() function.
   */
   class RayfireMesh
   {
@@ -94,6 +96,20 @@ namespace GRINS
     */
     void init(const libMesh::MeshBase& mesh_base);
 
+    //! Initialization with a known starting element
+    /*!
+    As init(mesh_base), but skips building a point locator to find the
+    element containing the origin. Used by RayfireBundle to share one
+    point locator between many rays.
+    @param mesh_base Reference to the main mesh
+    @param start_elem Active elem of the main mesh containing the origin
+    */
+    void init(const libMesh::MeshBase& mesh_base, const libMesh::Elem* start_elem);
+
+    //! Origin point of the rayfire
+    const libMesh::Point& origin() const
+    { return _origin; }
+
     /*!
     This function takes in an elem_id on the main mesh and returns an elem from the 1D rayfire mesh
     @param elem_id The ID of the elem on the main mesh
@@ -103,15 +119,20 @@ namespace GRINS
     const libMesh::Elem* map_to_rayfire_elem(const libMesh::dof_id_type elem_id);
 
     /*!
-    Checks for refined main mesh elements along the rayfire path.
-    If INACTIVE elements are found, they are passed to refine() to update the rayfire mesh.
-
-    Only 1 refinement can be done between reinit() calls.
-    Coarsening is not yet supported
+    Updates the rayfire mesh after the main mesh has been refined and/or coarsened.
+    Each rayfire elem is checked against the active main mesh elem containing its midpoint,
+    found by descending from its (never coarsened) level 0 ancestor. Rayfire elems whose
+    main mesh elem was coarsened are merged, those whose main mesh elem was refined
+    are re-walked through the active children. Any number of refinements and coarsenings
+    can be done between reinit() calls.
     @param mesh: reference to main mesh, needed to get Elem* from the stored elem_id's
     */
     void reinit(const libMesh::MeshBase& mesh_base);
 
+    //! Map of main mesh elem_id to rayfire mesh elems
+    const std::map<libMesh::dof_id_type,libMesh::Elem*>& elem_id_map() const
+    { return _elem_id_map; }
+
 
   private:
     //! Dimension of the main mesh
@@ -132,6 +153,11 @@ namespace GRINS
     //! Map of main mesh elem_id to rayfire mesh elems
     std::map<libMesh::dof_id_type,libMesh::Elem*> _elem_id_map;
 
+    //! Rayfire mesh elems, in order along the rayfire, and the id of the level 0 ancestor of their main mesh elem
+    /*! Level 0 elems are never coarsened away, so this lets reinit() find the rayfire
+        elems' current main mesh elems, even if their old main mesh elems were deleted. */
+    std::vector<std::pair<libMesh::Elem*,libMesh::dof_id_type> > _segments;
+
 
     //! User should never call the default constructor
     RayfireMesh();
@@ -192,8 +218,19 @@ namespace GRINS
     */
     bool newton_solve_intersection(libMesh::Point& initial_point, const libMesh::Elem* edge_elem, libMesh::Point* intersection_point);
 
-    //! Refinement of a rayfire element whose main mesh counterpart was refined
-    void refine(const libMesh::Elem* main_elem, libMesh::Elem* rayfire_elem);
+    //! Add a rayfire elem, in order along the rayfire, for the given main mesh elem
+    void add_segment(libMesh::Elem* rayfire_elem, const libMesh::Elem* main_elem);
+
+    //! Find the active descendant of elem containing point, nudged slightly along the rayfire
+    /*! Nudging picks the correct elem when point is on a side or vertex between children.
+        The nudge is at most max_nudge, e.g. half the remaining segment, so that it can't
+        leave elem. If the nudged point is in no child, the child containing point is used. */
+    const libMesh::Elem* get_active_elem(const libMesh::Elem* elem, const libMesh::Point& point,
+                                         libMesh::Real max_nudge = std::numeric_limits<libMesh::Real>::max()) const;
+
+    //! Replace a rayfire elem whose main mesh counterpart was refined by the rayfire through its active children
+    /*! @return The last main mesh elem along the re-walked segment */
+    const libMesh::Elem* rewalk_segment(const libMesh::Elem* top_parent, libMesh::Elem* rayfire_elem);
   };
 
 }
@@ -87,9 +87,6 @@ namespace GRINS
     //! v-velocity component variable index
     VariableIndex _v_var;
 
-    //! List of sumdomain ids for which we want to compute this QoI
-    std::set<libMesh::subdomain_id_type> _subdomain_ids;
-
   private:
     //! User never call default constructor.
     Vorticity();
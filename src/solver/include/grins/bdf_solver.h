@@ -0,0 +1,92 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef GRINS_BDF_SOLVER_H
+#define GRINS_BDF_SOLVER_H
+
+// C++
+#include <string>
+
+// GRINS
+#include "grins/implicit_stage_solver_base.h"
+
+namespace GRINS
+{
+  //! Backward differentiation formula time solver, orders 1-3
+  /*! Constant time step BDF methods. Each step is a single implicit
+      stage with
+
+      BDF1: B = u_n,                                 gamma = 1
+      BDF2: B = (4 u_n - u_{n-1})/3,                 gamma = 2/3
+      BDF3: B = (18 u_n - 9 u_{n-1} + 2 u_{n-2})/11, gamma = 6/11
+
+      The first steps use lower order until enough history is available.
+      The previous solutions are stored as system vectors so they are
+      written to, and read from, restart files. Since the coefficients assume
+      a constant time step, this solver cannot be used with adaptive time
+      stepping or deltat backtracking. */
+  class BDFSolver : public ImplicitStageSolverBase
+  {
+  public:
+
+    BDFSolver( sys_type& system, unsigned int order );
+
+    virtual ~BDFSolver(){};
+
+    virtual void init();
+
+    virtual void solve();
+
+    virtual void advance_timestep();
+
+    virtual unsigned int error_order() const
+    { return _order; }
+
+    //! Tell the solver whether a restart file was read
+    /*! On restart, the history is used as far as the restart file
+        actually provides it, i.e. per the count stored in the
+        n_history_vector_name() vector. Otherwise, or if that count is
+        missing, we start up with lower order steps. */
+    void set_history_available( bool history_available );
+
+    //! Name of the system vector holding u_{n-k}
+    static std::string history_vector_name( unsigned int k );
+
+    //! Name of the system vector holding the number of valid history vectors
+    /*! Every entry holds the count, so it is written to, and read from,
+        restart files along with the history itself. */
+    static std::string n_history_vector_name();
+
+  protected:
+
+    unsigned int _order;
+
+    //! Number of valid solutions older than u_n
+    unsigned int _n_history;
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_BDF_SOLVER_H
@@ -0,0 +1,133 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_DIRICHLET_VALUE_UPDATER_H
+#define GRINS_DIRICHLET_VALUE_UPDATER_H
+
+// C++
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+#include "libmesh/dense_vector.h"
+
+// libMesh forward declarations
+namespace libMesh
+{
+  class DirichletBoundary;
+  class Elem;
+  class System;
+}
+
+namespace GRINS
+{
+  //! Updates the values of time-dependent Dirichlet constraints in place
+  /*!
+    For Dirichlet boundary conditions given by a (time-dependent)
+    FunctionBase, the constraint rows don't change between time steps,
+    only the constrained values do. Rather than rebuilding every
+    constraint with System::reinit_constraints(), update() recomputes
+    just the Dirichlet values, the same way libMesh does: interpolation
+    at boundary vertices, then L2 projection onto the remaining dofs of
+    boundary edges and sides.
+
+    This is only valid while no other constraint depends on a Dirichlet
+    dof, since libMesh folds the Dirichlet values into such constraints,
+    e.g. for hanging nodes or periodic dofs next to a Dirichlet boundary.
+    constraints_rebuilt() checks for that, for boundary data this class
+    doesn't handle (solution-dependent functions, nodesets, edgesets,
+    non-C0 elements), and that recomputing the values reproduces those
+    libMesh just built. If any check fails, update() returns false and
+    the caller must rebuild the constraints.
+   */
+  class DirichletValueUpdater
+  {
+  public:
+
+    DirichletValueUpdater();
+    ~DirichletValueUpdater(){};
+
+    //! Recompute the Dirichlet values at the current system time
+    /*! Returns false, without changing anything, if the constraints
+        need to be rebuilt instead. */
+    bool update( libMesh::System& system );
+
+    //! Must be called whenever the system's constraints have been rebuilt
+    void constraints_rebuilt( libMesh::System& system );
+
+  private:
+
+    //! Element with sides on a Dirichlet boundary
+    struct BoundaryElem
+    {
+      const libMesh::Elem* elem;
+
+      //! Index of the boundary in the DofMap's DirichletBoundaries
+      unsigned int bdy;
+
+      //! Which sides of elem are on that boundary
+      std::vector<bool> on_bdy;
+
+      bool operator<( const BoundaryElem& other ) const
+      { return bdy < other.bdy; }
+    };
+
+    //! Compute the Dirichlet values of var on the boundary sides of elem
+    /*! Fills dofs with the dof indices of var, Ue with the values of the
+        ones flagged in fixed. Returns false if the element is not one we
+        know how to handle. */
+    bool project_element( libMesh::System& system,
+                          const libMesh::DirichletBoundary& bdy,
+                          const BoundaryElem& belem,
+                          unsigned int var,
+                          std::vector<libMesh::dof_id_type>& dofs,
+                          libMesh::DenseVector<libMesh::Number>& Ue,
+                          std::vector<bool>& fixed ) const;
+
+    //! Compute all the Dirichlet values and store them in the DofMap
+    /*! If check is true, instead compares them against the stored values
+        and returns false if any differs or any Dirichlet dof is missed. */
+    bool compute_values( libMesh::System& system, bool check );
+
+    //! Cheap fingerprint of the constraint structure
+    void fingerprint( const libMesh::System& system,
+                      std::vector<libMesh::dof_id_type>& print ) const;
+
+    //! Can update() be used with the current constraints?
+    bool _can_update;
+
+    //! Fingerprint when the constraints were last rebuilt
+    std::vector<libMesh::dof_id_type> _fingerprint;
+
+    //! Constrained dofs with no constraint row, i.e. Dirichlet dofs, sorted
+    std::vector<libMesh::dof_id_type> _dirichlet_dofs;
+
+    std::vector<BoundaryElem> _boundary_elems;
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_DIRICHLET_VALUE_UPDATER_H
@@ -0,0 +1,128 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef GRINS_ENSEMBLE_RUNNER_H
+#define GRINS_ENSEMBLE_RUNNER_H
+
+// C++
+#include <string>
+#include <vector>
+
+// libMesh
+#include "libmesh/getpot.h"
+#include "libmesh/parallel.h"
+
+namespace GRINS
+{
+  // Forward declarations
+  class SimulationBuilder;
+
+  //! Run several variants of one Simulation in a single process
+  /*! The [Ensemble] section of the input lists the members of the ensemble
+      and, for each member, the input variables it overrides:
+
+      [Ensemble]
+         members = 'low high'
+         n_groups = '2'
+         [./low]
+            overrides = 'Materials/Fluid/Viscosity/value=0.01'
+         [../high]
+            overrides = 'Materials/Fluid/Viscosity/value=0.1'
+
+      Each override is "<variable>=<value>"; use ',' in place of spaces for
+      vector-valued variables. The processors are split into n_groups
+      sub-communicators (default 1) and members are distributed round-robin
+      over the groups. Each group builds the mesh once and every member
+      of the group runs, in sequence, on its own copy of it, so we pay for
+      reading, refining, and partitioning the mesh only once per group.
+
+      The VariableWarehouse is process-global, so it is cleared before
+      each member is constructed; since members within a group run in
+      sequence and groups are disjoint sets of processors, each Simulation
+      sees only its own Variables. Overriding Mesh options is not allowed
+      since the mesh is shared. Visualization output of each member
+      is prefixed with the member name. */
+  class EnsembleRunner
+  {
+  public:
+
+    EnsembleRunner( const GetPot& input,
+                    GetPot& command_line,
+                    SimulationBuilder& sim_builder,
+                    const libMesh::Parallel::Communicator& comm );
+
+    ~EnsembleRunner(){};
+
+    //! Run all ensemble members assigned to this processor's group
+    void run();
+
+    //! Check if the input requests an ensemble run
+    static bool is_ensemble( const GetPot& input )
+    { return input.have_section("Ensemble/"); }
+
+    unsigned int n_members() const
+    { return _member_names.size(); }
+
+    unsigned int n_groups() const
+    { return _n_groups; }
+
+    //! The sub-communicator of the group this processor belongs to
+    const libMesh::Parallel::Communicator& group_comm() const
+    { return _group_comm; }
+
+    //! Build the input for a member by applying its overrides to the base input
+    void build_member_input( unsigned int member, GetPot& member_input ) const;
+
+  protected:
+
+    void parse_members();
+
+    void split_communicator( const libMesh::Parallel::Communicator& comm );
+
+    const GetPot& _input;
+
+    GetPot& _command_line;
+
+    SimulationBuilder& _sim_builder;
+
+    std::vector<std::string> _member_names;
+
+    //! Overrides for each member, as (variable, value) pairs
+    std::vector<std::vector<std::pair<std::string,std::string> > > _overrides;
+
+    unsigned int _n_groups;
+
+    unsigned int _group;
+
+    libMesh::Parallel::Communicator _group_comm;
+
+  private:
+
+    EnsembleRunner();
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_ENSEMBLE_RUNNER_H
@@ -29,6 +29,8 @@
 //GRINS
 #include "grins/grins_solver.h"
 #include "grins/adaptive_time_stepping_options.h"
+#include "grins/pid_time_step_controller.h"
+#include "grins/dirichlet_value_updater.h"
 
 //libMesh
 #include "libmesh/system_norm.h"
@@ -57,8 +59,44 @@ namespace GRINS
         we need to update the constraints with the new solution. */
     void update_dirichlet_bcs( SolverContext& context );
 
+    //! Must be called if the constraints are rebuilt outside update_dirichlet_bcs()
+    /*! E.g. after mesh refinement. */
+    void dirichlet_constraints_rebuilt( SolverContext& context );
+
     void init_second_order_in_time_solvers( SolverContext& context );
 
+    //! On restart, multistep solvers can use the history from the restart file
+    void init_multistep_solvers( SolverContext& context );
+
+    //! Solve the current time step
+    /*! If one of the PID time step controllers is active, this also
+        estimates the error of the step and, if the step is rejected,
+        re-solves it with a smaller time step, erroring out after
+        max_rejected_steps rejections or below min_deltat. */
+    void solve_time_step( SolverContext& context );
+
+    //! Advance to the next time step, updating deltat if time adaptive
+    void advance_time_step( SolverContext& context );
+
+    //! True if we're adapting the time step without TwostepTimeSolver
+    bool use_time_step_controller() const
+    { return _time_step_controller.get(); }
+
+    //! Error indicator of the current step, normalized by its target
+    libMesh::Real estimate_time_step_error( SolverContext& context );
+
+    //! Compare the solution against a linear extrapolation of the previous two steps
+    /*! The difference is the predictor-corrector estimate of the local
+        truncation error and is essentially free to compute. Like
+        TwostepTimeSolver, we return it relative to the solution norm
+        and per unit time, so target_tolerance means the same for both. */
+    libMesh::Real extrapolation_error( SolverContext& context );
+
+    bool reject_time_step( libMesh::Real normalized_error ) const;
+
+    static std::string older_solution_name()
+    { return "_grins_older_nonlinear_solution"; }
+
     std::string _time_solver_name;
 
     unsigned int _n_timesteps;
@@ -69,10 +107,28 @@ namespace GRINS
     // Options for adaptive time solvers
     AdaptiveTimeSteppingOptions _adapt_time_step_options;
 
+    //! Only built if we're adaptive with a controller other than "twostep"
+    libMesh::UniquePtr<PIDTimeStepController> _time_step_controller;
+
+    //! Only built if the user asked for incremental Dirichlet updates
+    libMesh::UniquePtr<DirichletValueUpdater> _dirichlet_updater;
+
+    //! Normalized error estimate of the most recently solved step
+    libMesh::Real _time_step_error;
+
+    //! Time step size between the old and older solutions
+    libMesh::Real _older_deltat;
+
+    //! Whether the "older" solution vector is populated yet
+    bool _have_older_solution;
+
     //! Track whether is this a second order (in time) solver or not
     /*! If it is, we need to potentially initialize the acceleration */
     bool _is_second_order_in_time;
 
+    //! Track whether this solver needs solutions from previous time steps
+    bool _is_multistep;
+
   };
 
   template <typename T>
@@ -0,0 +1,78 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef GRINS_IMPLICIT_STAGE_SOLVER_BASE_H
+#define GRINS_IMPLICIT_STAGE_SOLVER_BASE_H
+
+// libMesh
+#include "libmesh/euler_solver.h"
+
+// libMesh forward declarations
+namespace libMesh
+{
+  template <typename T>
+  class NumericVector;
+}
+
+namespace GRINS
+{
+  //! Base class for time integrators built from backward Euler stages
+  /*! Both BDF and (stiffly accurate) SDIRK methods can be written as a
+      sequence of implicit stages of the form
+
+      M (U - B)/(gamma*dt) = F(U, t_stage)
+
+      where B is a linear combination of previously computed solutions and
+      stage rates. Each such stage is exactly a libMesh::EulerSolver step with
+      theta = 1, step size gamma*dt, and "old" solution B, so we reuse the
+      EulerSolver residual, and thus the existing mass_residual and
+      element_time_derivative split in MultiphysicsSystem, and only manage
+      the stage data here. */
+  class ImplicitStageSolverBase : public libMesh::EulerSolver
+  {
+  public:
+
+    ImplicitStageSolverBase( sys_type& system );
+
+    virtual ~ImplicitStageSolverBase(){};
+
+  protected:
+
+    //! Solve one implicit stage
+    /*! The system deltat and time are restored on exit, as is the
+        localized old solution used by the residual evaluation. */
+    void solve_stage( const libMesh::NumericVector<libMesh::Number>& base_solution,
+                      libMesh::Real stage_deltat,
+                      libMesh::Real stage_time );
+
+    //! Error out if the user asked for libMesh deltat backtracking
+    /*! Halving deltat within a stage is inconsistent with the stage
+        coefficients, so we don't support it. */
+    void check_no_deltat_backtracking() const;
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_IMPLICIT_STAGE_SOLVER_BASE_H
@@ -26,6 +26,7 @@
 #define GRINS_MESH_ADAPTIVE_SOLVER_BASE_H
 
 // C++
+#include <map>
 #include <string>
 
 // GRINS
@@ -35,6 +36,7 @@
 //libMesh
 #include "libmesh/libmesh.h"
 #include "libmesh/mesh_refinement.h"
+#include "libmesh/id_types.h"
 
 // libMesh forward declarations
 class GetPot;
@@ -78,6 +80,11 @@ namespace GRINS
                               const MeshAdaptivityOptions& mesh_adaptivity_options,
                               RefinementFlaggingType& refinement_type );
 
+    //! Global error estimate from the error indicators
+    /*! The sum of the indicators for adjoint-based estimates, else their l2 norm. */
+    libMesh::Real compute_error_estimate( SolverContext& context,
+                                          const libMesh::ErrorVector& error ) const;
+
     bool check_for_convergence( SolverContext& context,
                                 const libMesh::ErrorVector& error ) const;
 
@@ -87,6 +94,27 @@ namespace GRINS
 
     void perform_amr( SolverContext& context, const libMesh::ErrorVector& error );
 
+    //! Start measuring element costs if we're rebalancing after AMR
+    void init_rebalancing( SolverContext& context );
+
+    //! Stash the measured cost of each active local element and its parent
+    /*! Keyed by Elem::unique_id() since element ids may be renumbered
+        during refinement. A parent gets the mean of its children's costs,
+        which is what it will cost if they're coarsened away. */
+    void cache_element_costs( SolverContext& context,
+                              std::map<libMesh::unique_id_type,libMesh::Real>& elem_costs ) const;
+
+    //! Repartition the mesh, weighted by element cost, if it's too imbalanced
+    /*! New children are assumed to cost as much as their parent did. The
+        solution is migrated by the subsequent EquationSystems::reinit(). */
+    void rebalance_mesh( libMesh::MeshBase& mesh,
+                         const std::map<libMesh::unique_id_type,libMesh::Real>& elem_costs );
+
+    //! Ratio of the maximum to mean processor cost
+    libMesh::Real compute_load_imbalance( const libMesh::MeshBase& mesh,
+                                          const libMesh::ErrorVector& elem_costs,
+                                          libMesh::Real& max_cost ) const;
+
   private:
 
     MeshAdaptiveSolverBase();
@@ -45,7 +45,9 @@ namespace GRINS
     //! This Object handles building a libMesh::UnstructuredMesh subclass.
     /*! Based on runtime input, either a generic 1, 2, or 3-dimensional
         mesh is built; or is read from input from a specified file. */
-    MeshBuilder(){};
+    MeshBuilder()
+      : _read_from_cache(false)
+    {};
     ~MeshBuilder(){};
 
     //! Builds the libMesh::Mesh according to input options.
@@ -63,8 +65,49 @@ namespace GRINS
                                         const libMesh::Parallel::Communicator &comm,
                                         libMesh::UnstructuredMesh& mesh ) const;
 
+    //! Name of the cached mesh file for this input, if caching is enabled
+    /*! When Mesh/Cache/directory is set, the built (and refined and
+        partitioned) mesh is written there in libMesh checkpoint format and
+        reused by later runs with matching input. The file name is keyed by
+        a hash of the [Mesh] input section, the restart file (since that
+        changes where refinement happens), the mesh file time stamp, and the
+        number of processors. Returns an empty string if caching is disabled. */
+    std::string mesh_cache_filename( const GetPot& input,
+                                     const libMesh::Parallel::Communicator &comm ) const;
+
+    //! Whether the last call to build() read the mesh from the cache
+    bool read_from_cache() const
+    { return _read_from_cache; }
+
   private:
 
+    //! Check whether filename is in a format libMesh reads in parallel
+    /*! Nemesis (.n, .nem) and checkpoint (.cpr, .cpa) files are stored
+        pre-split, one piece per processor, so a distributed mesh can be
+        read without every processor holding the whole mesh. */
+    bool is_pre_split_mesh_format( const std::string& filename ) const;
+
+    //! Check whether the partitioning read with the mesh fits this run
+    /*! A pre-split file keeps its partitioning only if it was split for
+        comm.size() processors and every processor got a piece. */
+    bool stored_partitioning_matches( const libMesh::MeshBase& mesh,
+                                      const libMesh::Parallel::Communicator &comm ) const;
+
+    //! Read the mesh from the cache, if the cache file exists
+    /*! Returns true if the mesh was read from the cache. */
+    bool read_cached_mesh( const std::string& cache_filename,
+                           const GetPot& input,
+                           const libMesh::Parallel::Communicator &comm,
+                           libMesh::UnstructuredMesh& mesh ) const;
+
+    //! Write the mesh to the cache
+    /*! The mesh is written under a temporary name, which processor 0 then
+        renames into place, so that other runs sharing the cache directory
+        never read a partially written mesh. */
+    void write_cached_mesh( const std::string& cache_filename,
+                            const libMesh::Parallel::Communicator &comm,
+                            libMesh::UnstructuredMesh& mesh ) const;
+
     void generate_mesh( const std::string& mesh_build_type, const GetPot& input,
                         libMesh::UnstructuredMesh* mesh );
 
@@ -74,6 +117,8 @@ namespace GRINS
                             const std::string& new_option, const T& default_value,
                             T& option_value ) const;
 
+    bool _read_from_cache;
+
   };
 
   template <typename T>
@@ -0,0 +1,63 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_MESH_SEQUENCING_SOLVER_H
+#define GRINS_MESH_SEQUENCING_SOLVER_H
+
+//GRINS
+#include "grins/grins_steady_solver.h"
+
+namespace GRINS
+{
+  //! Steady solver that converges on a sequence of uniformly refined meshes
+  /*!
+    Solves on the mesh built from the input file, uniformly refines it,
+    projecting the converged solution onto the refined mesh, and solves
+    again, SolverOptions/MeshSequencing/n_refinements times. Each Newton
+    solve but the first then starts from a good initial guess, which is
+    far cheaper for stiff nonlinear problems than starting cold on the
+    finest mesh. The solve on the finest mesh, with any adjoint solve and
+    output, is as in SteadySolver.
+   */
+  class MeshSequencingSolver : public SteadySolver
+  {
+  public:
+
+    MeshSequencingSolver( const GetPot& input );
+    virtual ~MeshSequencingSolver();
+
+    virtual void solve( SolverContext& context );
+
+  protected:
+
+    //! Uniformly refine the mesh once and project the solution onto it
+    void refine( SolverContext& context );
+
+    //! Number of uniform refinements between the first and last solves
+    unsigned int _n_refinements;
+
+  };
+} // namespace GRINS
+#endif // GRINS_MESH_SEQUENCING_SOLVER_H
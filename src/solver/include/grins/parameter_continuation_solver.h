@@ -0,0 +1,83 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_PARAMETER_CONTINUATION_SOLVER_H
+#define GRINS_PARAMETER_CONTINUATION_SOLVER_H
+
+//GRINS
+#include "grins/grins_steady_solver.h"
+
+namespace GRINS
+{
+  //! Steady solver that sweeps a parameter through a sequence of steady solutions
+  /*!
+    Solves at the current value of the parameter named by
+    SolverOptions/ParameterContinuation/parameter, then steps it in
+    n_steps equal increments to final_value, solving at each. Before each
+    Newton solve, the solution is predicted to first order from the
+    forward sensitivity du/dp at the previous value,
+
+      u(p+dp) ~ u(p) + dp*du/dp,
+
+    which costs one linear solve with the converged Jacobian and leaves
+    Newton only the nonlinear correction. QoIs, if requested, and
+    visualization are output at each value. The solve at final_value, with
+    any adjoint solve, is as in SteadySolver.
+
+    The parameter is registered by the Simulation, which passes it
+    through the SolverContext, since QoIs are attached only after the
+    solver is initialized.
+   */
+  class ParameterContinuationSolver : public SteadySolver
+  {
+  public:
+
+    ParameterContinuationSolver( const GetPot& input );
+    virtual ~ParameterContinuationSolver();
+
+    virtual void solve( SolverContext& context );
+
+  protected:
+
+    //! Predict the solution at the parameter value p+dp from du/dp at p
+    void predict( SolverContext& context,
+                  libMesh::ParameterVector& parameters,
+                  libMesh::Number delta_p );
+
+    //! Print the step, parameter value and Newton iteration count
+    void print_step( SolverContext& context,
+                     unsigned int step,
+                     libMesh::Number parameter ) const;
+
+    libMesh::Number _final_value;
+
+    unsigned int _n_steps;
+
+    //! Predict with du/dp? Otherwise, start Newton from the previous solution
+    bool _use_predictor;
+
+  };
+} // namespace GRINS
+#endif // GRINS_PARAMETER_CONTINUATION_SOLVER_H
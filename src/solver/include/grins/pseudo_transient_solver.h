@@ -0,0 +1,99 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_PSEUDO_TRANSIENT_SOLVER_H
+#define GRINS_PSEUDO_TRANSIENT_SOLVER_H
+
+//GRINS
+#include "grins/grins_steady_solver.h"
+
+namespace GRINS
+{
+  //! Steady solver that marches in pseudo time toward the steady state
+  /*!
+    Newton's method applied directly to a stiff steady problem often fails
+    to converge from a poor initial guess. Here, backward Euler steps in
+    pseudo time, which add the mass_residual() terms of each Physics scaled
+    by 1/dt to the Jacobian, are taken instead. The pseudo time step starts
+    at SolverOptions/PseudoTransient/initial_deltat and grows with the
+    switched evolution relaxation (SER) rule
+
+      dt_{n+1} = dt_n * (|R_{n-1}|/|R_n|)^ser_exponent,
+
+    where |R| is the l2 norm of the steady residual, so that the steps
+    approach Newton steps as the residual falls. A step whose nonlinear
+    solve fails is retried from the old solution with half the time step.
+
+    Once the steady residual has fallen by relative_tolerance, or below
+    absolute_tolerance, the time solver is replaced by a steady one and the
+    solve, with any adjoint solve and output, finishes as in SteadySolver.
+    Stabilized Physics, whose tau depends on whether the solver is steady,
+    then converge to the same state as a SteadySolver would.
+   */
+  class PseudoTransientSolver : public SteadySolver
+  {
+  public:
+
+    PseudoTransientSolver( const GetPot& input );
+    virtual ~PseudoTransientSolver();
+
+    virtual void initialize( const GetPot& input,
+                             SharedPtr<libMesh::EquationSystems> equation_system,
+                             GRINS::MultiphysicsSystem* system );
+
+    virtual void solve( SolverContext& context );
+
+  protected:
+
+    //! Backward Euler in pseudo time
+    virtual void init_time_solver(GRINS::MultiphysicsSystem* system);
+
+    //! l2 norm of the steady residual at the current solution
+    /*! Only valid right after advancing the time solver, when the old
+        solution equals the current one and the mass terms vanish. */
+    libMesh::Real steady_residual_norm( SolverContext& context ) const;
+
+    //! Replace the pseudo time solver with a steady one
+    void switch_to_steady( SolverContext& context );
+
+    libMesh::Real _initial_deltat;
+    libMesh::Real _max_deltat;
+
+    //! Bound on the factor the time step can grow, or shrink, by in one step
+    libMesh::Real _max_growth;
+
+    libMesh::Real _ser_exponent;
+
+    unsigned int _max_steps;
+
+    //! Consecutive failed solves allowed before giving up
+    unsigned int _max_step_failures;
+
+    libMesh::Real _relative_tolerance;
+    libMesh::Real _absolute_tolerance;
+
+  };
+} // namespace GRINS
+#endif // GRINS_PSEUDO_TRANSIENT_SOLVER_H
@@ -0,0 +1,75 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef GRINS_SDIRK_SOLVER_H
+#define GRINS_SDIRK_SOLVER_H
+
+// C++
+#include <vector>
+
+// GRINS
+#include "grins/implicit_stage_solver_base.h"
+
+namespace GRINS
+{
+  //! Singly diagonally implicit Runge-Kutta time solver
+  /*! We use the L-stable, stiffly accurate methods of Alexander,
+      "Diagonally implicit Runge-Kutta methods for stiff O.D.E.'s",
+      SIAM J. Numer. Anal. 14 (1977): the two stage, second order method and
+      the three stage, third order method. Stage i solves
+
+      M (U_i - u_n - dt sum_{j<i} a_ij K_j)/(a_ii dt) = F(U_i, t_n + c_i dt)
+
+      for U_i, and the stage rate K_i is the left-hand side quotient. Since
+      the methods are stiffly accurate, u_{n+1} = U_s. This is a one step
+      method, so it works with adaptive time stepping and restarts without
+      any extra history. */
+  class SDIRKSolver : public ImplicitStageSolverBase
+  {
+  public:
+
+    SDIRKSolver( sys_type& system, unsigned int order );
+
+    virtual ~SDIRKSolver(){};
+
+    virtual void solve();
+
+    virtual unsigned int error_order() const
+    { return _order; }
+
+  protected:
+
+    void init_butcher_tableau();
+
+    unsigned int _order;
+
+    //! Butcher tableau; _a is lower triangular, stored row-wise
+    std::vector<std::vector<libMesh::Real> > _a;
+    std::vector<libMesh::Real> _c;
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_SDIRK_SOLVER_H
@@ -97,6 +97,15 @@ namespace GRINS
 
     void read_restart( const GetPot& input );
 
+    //! Set the initial solution by interpolating a solution from a coarser mesh
+    /*! The coarse solution is read from restart-options/coarse_restart_file,
+        on the mesh in restart-options/coarse_mesh_file uniformly refined
+        restart-options/coarse_uniformly_refine times, and interpolated at
+        the nodes of our mesh, which the coarse mesh must cover. Unlike
+        read_restart(), this is only an initial guess: no solution history
+        is read. */
+    void read_coarse_restart( const GetPot& input );
+
     //! Helper function
     void init_multiphysics_system( const GetPot& input );
 
@@ -162,6 +171,9 @@ namespace GRINS
 
     ParameterManager _forward_parameters;
 
+    //! The parameter stepped by a ParameterContinuationSolver
+    ParameterManager _continuation_parameters;
+
     // Cache whether or not we do an adjoint solve
     bool _do_adjoint_solve;
 
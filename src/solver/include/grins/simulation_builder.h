@@ -63,6 +63,13 @@ namespace GRINS
 
     void attach_mesh_builder( SharedPtr<MeshBuilder> mesh_builder );
 
+    //! Use a copy of this mesh instead of building one from input
+    /*! Lets several Simulations reuse one mesh that has already been read,
+        refined, and partitioned. Each call to build_mesh() returns a fresh
+        copy since each EquationSystems needs its own mesh. The mesh must
+        live on the communicator passed to build_mesh(). */
+    void attach_mesh( SharedPtr<libMesh::UnstructuredMesh> mesh );
+
     void attach_vis_factory( SharedPtr<VisualizationFactory> vis_factory );
 
     void attach_qoi_factory( SharedPtr<QoIFactory> qoi_factory );
@@ -74,6 +81,7 @@ namespace GRINS
   protected:
 
     SharedPtr<MeshBuilder> _mesh_builder;
+    SharedPtr<libMesh::UnstructuredMesh> _mesh;
     SharedPtr<SolverFactory> _solver_factory;
     SharedPtr<VisualizationFactory> _vis_factory;
     SharedPtr<QoIFactory> _qoi_factory;
@@ -47,6 +47,20 @@ namespace GRINS
     static std::string restart_file( const GetPot& input )
     { return input( SimulationParsing::restart_input_option(), "none" ); }
 
+    //! Are we initializing the solution from a solution on a coarser mesh?
+    static bool have_coarse_restart( const GetPot& input )
+    { return input.have_variable( "restart-options/coarse_restart_file" ); }
+
+    static std::string coarse_restart_file( const GetPot& input )
+    { return input( "restart-options/coarse_restart_file", "none" ); }
+
+    //! The mesh the coarse solution was computed on, before coarse_uniformly_refine()
+    static std::string coarse_mesh_file( const GetPot& input )
+    { return input( "restart-options/coarse_mesh_file", "none" ); }
+
+    static unsigned int coarse_uniformly_refine( const GetPot& input )
+    { return input( "restart-options/coarse_uniformly_refine", 0 ); }
+
   private:
 
     static std::string restart_input_option()
@@ -37,6 +37,12 @@
 #include "libmesh/error_estimator.h"
 #include "libmesh/equation_systems.h"
 
+// libMesh forward declarations
+namespace libMesh
+{
+  class ParameterVector;
+}
+
 namespace GRINS
 {
   // Forward declarations
@@ -75,6 +81,9 @@ namespace GRINS
 
     bool have_restart;
 
+    //! The parameter a ParameterContinuationSolver steps, if any
+    libMesh::ParameterVector* continuation_parameters;
+
   };
 
 } // end namespace GRINS
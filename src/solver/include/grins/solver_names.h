@@ -43,6 +43,15 @@ namespace GRINS
     static const std::string unsteady_mesh_adaptive_solver()
     { return "grins_unsteady_mesh_adaptive_solver"; }
 
+    static const std::string mesh_sequencing_solver()
+    { return "grins_mesh_sequencing_solver"; }
+
+    static const std::string pseudo_transient_solver()
+    { return "grins_pseudo_transient_solver"; }
+
+    static const std::string parameter_continuation_solver()
+    { return "grins_parameter_continuation_solver"; }
+
     static const std::string libmesh_euler_solver()
     { return "libmesh_euler_solver"; }
 
@@ -52,5 +61,17 @@ namespace GRINS
     static const std::string libmesh_newmark_solver()
     { return "libmesh_newmark"; }
 
+    static const std::string grins_bdf2_solver()
+    { return "grins_bdf2_solver"; }
+
+    static const std::string grins_bdf3_solver()
+    { return "grins_bdf3_solver"; }
+
+    static const std::string grins_sdirk2_solver()
+    { return "grins_sdirk2_solver"; }
+
+    static const std::string grins_sdirk3_solver()
+    { return "grins_sdirk3_solver"; }
+
   };
 } // end namespace GRINS
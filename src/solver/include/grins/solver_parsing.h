@@ -45,6 +45,15 @@ namespace GRINS
 
     static bool is_transient( const GetPot& input );
 
+    //! Was a steady solve on a sequence of uniformly refined meshes requested?
+    static bool is_mesh_sequencing( const GetPot& input );
+
+    //! Was a steady solve by pseudo transient continuation requested?
+    static bool is_pseudo_transient( const GetPot& input );
+
+    //! Was a sweep of a parameter through steady solutions requested?
+    static bool is_parameter_continuation( const GetPot& input );
+
     static void dup_solver_option_check( const GetPot& input,
                                          const std::string& option1,
                                          const std::string& option2 );
@@ -56,6 +56,11 @@ namespace GRINS
     static double parse_deltat( const GetPot& input );
 
     static std::string parse_time_stepper_name( const GetPot& input );
+
+    //! Parse option to update time-dependent Dirichlet values in place
+    /*! Instead of rebuilding all the constraints each time step; see
+        DirichletValueUpdater. Defaults to false. */
+    static bool parse_incremental_dirichlet_update( const GetPot& input );
   };
 
 } // end namespace GRINS
@@ -46,6 +46,25 @@ namespace GRINS
 
     virtual void solve(  SolverContext& context );
 
+  protected:
+
+    //! Solve the time step, re-solving on each refined mesh until converged
+    void solve_and_refine( SolverContext& context, unsigned int t_step );
+
+    //! Solve the time step once, then refine the mesh for the next time step
+    /*! Refinement is done every refinement_interval time steps, or sooner if
+        the error estimate has grown by refinement_error_growth since the last
+        refinement. The solution projected onto the refined mesh is the
+        initial guess for the next time step. */
+    void solve_and_predict_refinement( SolverContext& context, unsigned int t_step );
+
+    //! Visualization and other output after each time step solve
+    void output_time_step( SolverContext& context, unsigned int t_step );
+
+    //! Error estimate on the first time step after the last refinement
+    /*! A negative value means we haven't estimated since the last refinement. */
+    libMesh::Real _reference_error;
+
   };
 
 } // end namespace GRINS
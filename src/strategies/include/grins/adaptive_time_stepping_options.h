@@ -58,6 +58,37 @@ namespace GRINS
     const libMesh::SystemNorm& component_norm()
     { return _component_norm; }
 
+    //! Algorithm used to control the time step size
+    /*! "twostep" wraps the time solver in libMesh::TwostepTimeSolver.
+        "extrapolation" and "nonlinear_iterations" use a PID controller
+        on a cheap error indicator so each time step is solved only once. */
+    const std::string& controller_type() const
+    { return _controller_type; }
+
+    bool use_twostep_controller() const;
+
+    unsigned int target_nonlinear_iterations() const
+    { return _target_nonlinear_iterations; }
+
+    double pid_k_p() const
+    { return _pid_k_p; }
+
+    double pid_k_i() const
+    { return _pid_k_i; }
+
+    double pid_k_d() const
+    { return _pid_k_d; }
+
+    //! Maximum number of consecutive rejections of one time step
+    /*! Only used by the extrapolation controller. */
+    unsigned int max_rejected_steps() const
+    { return _max_rejected_steps; }
+
+    //! Smallest time step a rejected step may be retried with
+    /*! Only used by the extrapolation controller. */
+    double min_deltat() const
+    { return _min_deltat; }
+
   private:
 
     void check_dup_input_style( const GetPot& input ) const;
@@ -70,6 +101,8 @@ namespace GRINS
 
     void parse_options(const GetPot& input, const std::string& section);
 
+    void parse_controller_options(const GetPot& input, const std::string& section);
+
     bool   _is_time_adaptive;
 
     // target tolerance parameter for adaptive time stepping
@@ -82,6 +115,21 @@ namespace GRINS
 
     // The norm to use for each solution variable for adaptive time stepping
     libMesh::SystemNorm _component_norm;
+
+    std::string _controller_type;
+
+    //! Desired number of nonlinear iterations per time step
+    /*! Only used by the nonlinear_iterations controller. */
+    unsigned int _target_nonlinear_iterations;
+
+    unsigned int _max_rejected_steps;
+
+    double _min_deltat;
+
+    //! Proportional, integral, and derivative gains for the PID controllers
+    double _pid_k_p;
+    double _pid_k_i;
+    double _pid_k_d;
   };
 
 } // end namespace GRINS
@@ -61,6 +61,13 @@ namespace GRINS
                                                                                MultiphysicsSystem& system,
                                                                                const ErrorEstimatorOptions& estimator_options ) =0;
 
+    //! Set the per-variable norms and weights requested in estimator_options
+    /*! Builds a libMesh::SystemNorm starting from the current norm type of
+        the estimator. Does nothing if no variable weights were given. */
+    static void set_error_norm( const libMesh::System& system,
+                                const ErrorEstimatorOptions& estimator_options,
+                                libMesh::ErrorEstimator& estimator );
+
     //! Cache pointer to system
     /*! We can't copy this so it must be a pointer. We do *not* own
         this so do not delete! */
@@ -27,6 +27,10 @@
 
 // C++
 #include <string>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
 
 // libmMesh forward declarations
 class GetPot;
@@ -58,6 +62,26 @@ namespace GRINS
 
     bool estimator_requires_adjoint() const;
 
+    //! Variables whose contribution to the error indicator is weighted
+    /*! Other variables are weighted by unweighted_variable_weight(), so
+        setting that to 0 restricts the indicator to, e.g., temperature
+        and selected species to target flame fronts and thermal layers. */
+    const std::vector<std::string>& weighted_variables() const
+    { return _weighted_variables; }
+
+    const std::vector<libMesh::Real>& variable_weights() const
+    { return _variable_weights; }
+
+    //! Norm used for each weighted variable (empty to use the estimator default)
+    const std::vector<std::string>& variable_norms() const
+    { return _variable_norms; }
+
+    libMesh::Real unweighted_variable_weight() const
+    { return _unweighted_variable_weight; }
+
+    bool have_variable_weights() const
+    { return !_weighted_variables.empty(); }
+
   private:
 
     void check_dup_input_style( const GetPot& input ) const;
@@ -68,12 +92,19 @@ namespace GRINS
 
     void parse_new_style(const GetPot& input);
 
+    void parse_variable_weights(const GetPot& input, const std::string& section);
+
     std::string _estimator_type;
     bool _patch_reuse;
     unsigned char _n_adjoint_h_refinements;
     unsigned char _n_adjoint_p_refinements;
     bool _compute_qoi_error_estimate;
 
+    std::vector<std::string> _weighted_variables;
+    std::vector<libMesh::Real> _variable_weights;
+    std::vector<std::string> _variable_norms;
+    libMesh::Real _unweighted_variable_weight;
+
   };
 
 } // end namespace GRINS
@@ -90,6 +90,30 @@ namespace GRINS
     unsigned int max_h_level() const
     { return _max_h_level; }
 
+    //! Load imbalance (max/mean processor cost) above which we repartition after AMR
+    /*! A value of 0 (the default) disables cost-weighted rebalancing. */
+    libMesh::Real rebalance_imbalance_tolerance() const
+    { return _rebalance_imbalance_tolerance; }
+
+    bool do_rebalancing() const
+    { return (_rebalance_imbalance_tolerance > 0); }
+
+    //! Refine unsteady solutions after the time step solve, for the next time step
+    /*! Instead of re-solving each time step on successively refined meshes,
+        the error estimate from the current time step is used to refine the
+        mesh for the next one, so each time step takes a single solve. */
+    bool predictive_refinement() const
+    { return _predictive_refinement; }
+
+    //! Number of time steps between refinements with predictive_refinement
+    unsigned int refinement_interval() const
+    { return _refinement_interval; }
+
+    //! Refine early if the error grows by more than this factor since the last refinement
+    /*! Only used with predictive_refinement. A value of 0 (the default) disables this. */
+    libMesh::Real refinement_error_growth() const
+    { return _refinement_error_growth; }
+
   private:
 
     void check_dup_input_style( const GetPot& input ) const;
@@ -121,6 +145,12 @@ namespace GRINS
 
     unsigned int _max_h_level;
 
+    libMesh::Real _rebalance_imbalance_tolerance;
+
+    bool _predictive_refinement;
+    unsigned int _refinement_interval;
+    libMesh::Real _refinement_error_growth;
+
   };
 
 } // end namespace GRINS
@@ -0,0 +1,83 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+#ifndef GRINS_PID_TIME_STEP_CONTROLLER_H
+#define GRINS_PID_TIME_STEP_CONTROLLER_H
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+namespace GRINS
+{
+  //! PID controller for the time step size
+  /*! Given a normalized error indicator e_n for the time step just taken
+      (e_n = 1 means the step was exactly on target), the next time step is
+
+      dt_{n+1} = (e_{n-1}/e_n)^k_p (1/e_n)^k_i (e_{n-1}^2/(e_n e_{n-2}))^k_d dt_n
+
+      following Valli, Carey, and Coutinho, "Control strategies for timestep
+      selection in finite element simulation of incompressible flows and
+      coupled reaction-convection-diffusion processes", IJNMF 47 (2005).
+      Missing history is treated as on target, so the first steps reduce to
+      a pure integral controller. The growth/shrink factor is clamped to
+      [1/max_growth, max_growth]. */
+  class PIDTimeStepController
+  {
+  public:
+
+    PIDTimeStepController( libMesh::Real k_p, libMesh::Real k_i, libMesh::Real k_d,
+                           libMesh::Real max_growth );
+
+    ~PIDTimeStepController(){};
+
+    //! Next time step size given the error of the current step
+    /*! Does not modify the error history; call accept() once the
+        step is accepted. */
+    libMesh::Real compute_deltat( libMesh::Real normalized_error,
+                                  libMesh::Real deltat ) const;
+
+    //! Push the error of an accepted step into the history
+    void accept( libMesh::Real normalized_error );
+
+    //! Forget the error history
+    void reset();
+
+  private:
+
+    libMesh::Real _k_p;
+    libMesh::Real _k_i;
+    libMesh::Real _k_d;
+    libMesh::Real _max_growth;
+
+    //! Normalized errors of the previous two accepted steps
+    libMesh::Real _e_nm1;
+    libMesh::Real _e_nm2;
+
+    PIDTimeStepController();
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_PID_TIME_STEP_CONTROLLER_H
@@ -58,6 +58,15 @@ namespace GRINS
     static std::string patch_recovery_error_estimator()
     { return "patch_recovery"; }
 
+    static std::string twostep_time_step_controller()
+    { return "twostep"; }
+
+    static std::string extrapolation_time_step_controller()
+    { return "extrapolation"; }
+
+    static std::string nonlinear_iterations_time_step_controller()
+    { return "nonlinear_iterations"; }
+
     //! Option to let user manually trigger adjoint solve
     static bool do_adjoint_solve( const GetPot& input );
   };
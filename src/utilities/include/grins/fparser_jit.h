@@ -0,0 +1,64 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+//
+// GRINS - General Reacting Incompressible Navier-Stokes
+//
+// Copyright (C) 2014-2016 Paul T. Bauman, Roy H. Stogner
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+
+
+#ifndef GRINS_FPARSER_JIT_H
+#define GRINS_FPARSER_JIT_H
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/fparser_ad.hh"
+
+// libMesh forward declarations
+class GetPot;
+
+namespace GRINS
+{
+  namespace FParserJIT
+  {
+    //! Has the user asked for parsed functions to be compiled to native code?
+    /*!
+      Reads Strategies/ParsedFunctions/jit_compile. Warns and returns
+      false if libMesh was built without FParser JIT support.
+    */
+    bool requested( const GetPot& input );
+
+    //! Compile the current bytecode of the parser to native code
+    /*!
+      FParserAD generates C++ for the bytecode, builds it with the system
+      compiler and keeps the result in an on-disk cache keyed by a hash of
+      the bytecode, so later runs with the same expressions skip the
+      compiler. Eval() then calls the native code.
+
+      Returns false, leaving the parser interpreting, if compilation
+      fails or isn't supported. Call this after Optimize(); any later
+      change to the parser drops back to the interpreter.
+    */
+    bool compile( libMesh::FunctionParserADBase<libMesh::Number>& parser );
+
+  } // end namespace FParserJIT
+
+} // end namespace GRINS
+
+#endif // GRINS_FPARSER_JIT_H
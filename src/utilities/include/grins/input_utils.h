@@ -27,6 +27,11 @@
 #define GRINS_INPUT_UTILS_H
 
 #include <istream>
+#include <string>
+#include <vector>
+
+// libMesh forward declarations
+class GetPot;
 
 namespace GRINS
 {
@@ -40,6 +45,26 @@ namespace GRINS
   */
   void skip_comment_lines( std::istream &in, const char comment_start);
 
+  /*!
+    Hash of all input variables within the given sections, returned
+    as a hex string. Variables are hashed as sorted name=value pairs so
+    the result doesn't depend on their order in the input file. Variables
+    in excluded_sections are skipped. Used to key cached startup data,
+    so this is a 64-bit FNV-1a hash, not a cryptographic one. Reading
+    the variables does not mark them as used in input.
+  */
+  std::string hash_input_sections( const GetPot& input,
+                                   const std::vector<std::string>& sections,
+                                   const std::vector<std::string>& excluded_sections );
+
+  //! Mark all input variables within the given sections as used
+  /*! For when cached data replaces the parsing of those sections. */
+  void mark_input_sections_used( const GetPot& input,
+                                 const std::vector<std::string>& sections );
+
+  //! 64-bit FNV-1a hash of str, returned as a hex string
+  std::string hash_string( const std::string& str );
+
 } //namespace GRINS
 
 #endif //GRINS_INPUT_UTILS_H
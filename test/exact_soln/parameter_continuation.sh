@@ -0,0 +1,29 @@
+#!/bin/bash
+
+set -e
+
+INPUT="${GRINS_TEST_INPUT_DIR}/parameter_continuation.in"
+
+TESTDATA_NOTUSED="./parameter_continuation.0.xdr ./parameter_continuation.1.xdr ./parameter_continuation.2.xdr ./parameter_continuation.3.xdr"
+TESTDATA="./parameter_continuation.xdr"
+
+PETSC_OPTIONS="-pc_type asm -pc_asm_overlap 2 -sub_pc_type lu -sub_pc_factor_shift_type nonzero"
+
+# First run the case with grins
+${LIBMESH_RUN:-} ${GRINS_BUILDSRC_DIR}/grins $INPUT $PETSC_OPTIONS
+
+# Now run the test part to make sure we're getting the correct thing;
+# the pressure gradient is only right for the final viscosity, 2.0
+${LIBMESH_RUN:-} ${GRINS_TEST_DIR}/generic_exact_solution_testing_app \
+                 input=$INPUT vars='u v p' \
+                 norms='L2' tol='5.0e-9' \
+                 u_L2_error='1.0e-10' \
+                 v_L2_error='1.0e-10' \
+                 p_L2_error='1.0e-10' \
+                 u_exact_soln='y-y^2' \
+                 v_exact_soln='0.0' \
+                 p_exact_soln='100.0-4.0*(x-2.5)' \
+                 test_data=$TESTDATA
+
+# Now remove the test turd
+rm $TESTDATA $TESTDATA_NOTUSED
@@ -0,0 +1,7 @@
+#!/bin/bash
+
+PROG="${GRINS_TEST_DIR}/rayfire_qoi"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/rayfire_qoi.in"
+
+${LIBMESH_RUN:-} $PROG $INPUT
@@ -0,0 +1,7 @@
+#!/bin/bash
+
+PROG="${GRINS_TEST_DIR}/batched_sensitivity"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/batched_sensitivity.in"
+
+${LIBMESH_RUN:-} $PROG $INPUT
@@ -0,0 +1,14 @@
+#!/bin/bash
+
+PROG="${GRINS_TEST_DIR}/batched_sensitivity"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/batched_sensitivity_antioch.in"
+
+# A MOAB preconditioner
+PETSC_OPTIONS="-pc_type asm -pc_asm_overlap 10 -sub_pc_type ilu -sub_pc_factor_shift_type nonzero -sub_pc_factor_levels 10"
+
+if [ $GRINS_ANTIOCH_ENABLED == 1 ]; then
+   ${LIBMESH_RUN:-} $PROG $INPUT tol='1.0e-6' $PETSC_OPTIONS
+else
+   exit 77;
+fi
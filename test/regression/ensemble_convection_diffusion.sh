@@ -0,0 +1,36 @@
+#!/bin/bash
+
+set -e
+
+INPUT="${GRINS_TEST_INPUT_DIR}/ensemble_convection_diffusion_steady_1d.in"
+TESTDATA_PE40="./ensemble_convection_diffusion_steady_1d_pe40.xdr"
+TESTDATA_PE20="./ensemble_convection_diffusion_steady_1d_pe20.xdr"
+
+# Run both ensemble members with grins
+${LIBMESH_RUN:-} ${GRINS_BUILDSRC_DIR}/grins $INPUT
+
+# Each member must match the exact solution for its own diffusivity.
+# With u_L2_error='0', tol is an upper bound on the error; the single
+# run of convection_diffusion_steady_1d has an L2 error of 4.12e-04
+# for Pe = 40, and the error is smaller for Pe = 20. The two exact
+# solutions differ by far more than tol.
+${LIBMESH_RUN:-} ${GRINS_TEST_DIR}/generic_exact_solution_testing_app \
+                 input=$INPUT \
+                 vars='u' \
+                 norms='L2' \
+                 tol='5.0e-04' \
+                 u_L2_error='0.0' \
+                 u_exact_soln='x-(1-exp(40*x))/(1-exp(40))' \
+                 test_data=$TESTDATA_PE40
+
+${LIBMESH_RUN:-} ${GRINS_TEST_DIR}/generic_exact_solution_testing_app \
+                 input=$INPUT \
+                 vars='u' \
+                 norms='L2' \
+                 tol='5.0e-04' \
+                 u_L2_error='0.0' \
+                 u_exact_soln='x-(1-exp(20*x))/(1-exp(20))' \
+                 test_data=$TESTDATA_PE20
+
+# Now remove the test turds
+rm $TESTDATA_PE40 $TESTDATA_PE20
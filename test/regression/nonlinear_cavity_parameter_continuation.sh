@@ -0,0 +1,8 @@
+#!/bin/bash
+
+PROG="${GRINS_TEST_DIR}/steady_solver_newton_iterations"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/nonlinear_cavity_parameter_continuation.in"
+BASELINE="${GRINS_TEST_INPUT_DIR}/nonlinear_cavity.in"
+
+${LIBMESH_RUN:-} $PROG input=$INPUT baseline=$BASELINE vars='u v p' tol='1.0e-8'
@@ -0,0 +1,7 @@
+#!/bin/bash
+
+PROG="${GRINS_TEST_DIR}/parsed_qoi_derivative"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/parsed_qoi_derivative.in"
+
+${LIBMESH_RUN:-} $PROG $INPUT
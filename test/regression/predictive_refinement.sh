@@ -0,0 +1,7 @@
+#!/bin/bash
+
+PROG="${GRINS_TEST_DIR}/predictive_refinement"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/predictive_refinement.in"
+
+${LIBMESH_RUN:-} $PROG $INPUT reduction='0.8'
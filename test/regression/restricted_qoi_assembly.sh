@@ -0,0 +1,8 @@
+#!/bin/bash
+
+PROG="${GRINS_TEST_DIR}/restricted_qoi_assembly"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/restricted_qoi_assembly.in"
+
+# Threads share the QoI element list, and each needs its own QoI clones
+${LIBMESH_RUN:-} $PROG $INPUT --n_threads=2
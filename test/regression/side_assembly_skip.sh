@@ -0,0 +1,7 @@
+#!/bin/bash
+
+PROG="${GRINS_TEST_DIR}/side_assembly_skip"
+
+INPUT="${GRINS_TEST_INPUT_DIR}/side_assembly_skip.in"
+
+${LIBMESH_RUN:-} $PROG $INPUT